@@ -5,6 +5,7 @@
 
 #include <QPainter>
 
+#include <QDataStream>
 #include <QtMath>
 
 #include "op_amp.h"
@@ -131,6 +132,23 @@ void OpAmp::updateStep()
     voltChanged();
 }
 
+bool OpAmp::saveState( QDataStream& s )
+{
+    s << m_lastIn << m_lastOut;
+    return true;
+}
+
+bool OpAmp::loadState( QDataStream& s, bool check )
+{
+    double lastIn, lastOut;
+    s >> lastIn >> lastOut;
+    if( check || s.status() != QDataStream::Ok ) return s.status() == QDataStream::Ok;
+
+    m_lastIn  = lastIn;
+    m_lastOut = lastOut;
+    return true;
+}
+
 void OpAmp::voltChanged() // Called when any pin node change volt
 {
     if( m_powerPins )
@@ -25,6 +25,8 @@ class OpAmp : public Component, public eElement
         virtual void stamp() override;
         virtual void updateStep() override;
         virtual void voltChanged() override;
+        virtual bool saveState( QDataStream& s ) override;
+        virtual bool loadState( QDataStream& s, bool check ) override;
 
         double gain() { return m_gain; }
         void setGain( double g ) { m_gain = g; m_changed = true; }
@@ -3,6 +3,8 @@
  *                                                                         *
  ***( see copyright.txt file at root folder )*******************************/
 
+#include <QDataStream>
+
 #include "iocomponent.h"
 #include "circuitwidget.h"
 #include "simulator.h"
@@ -141,6 +143,36 @@ void IoComponent::scheduleOutPuts( eElement* el )
     m_outQueue.push( m_nextOutVal );
 }
 
+void IoComponent::saveOutState( QDataStream& s )
+{
+    QVector<uint> outQueue;
+    QVector<quint64> timeQueue;
+    for( std::queue<uint> q = m_outQueue; !q.empty(); q.pop() ) outQueue.append( q.front() );
+    for( std::queue<uint64_t> q = m_timeQueue; !q.empty(); q.pop() ) timeQueue.append( q.front() );
+
+    s << m_outValue << m_nextOutVal << outQueue << timeQueue;
+}
+
+bool IoComponent::loadOutState( QDataStream& s, bool check )
+{
+    uint outValue, nextOutVal;
+    QVector<uint> outQueue;
+    QVector<quint64> timeQueue;
+    s >> outValue >> nextOutVal >> outQueue >> timeQueue;
+
+    if( s.status() != QDataStream::Ok ) return false;
+    if( timeQueue.size() != qMax( outQueue.size()-1, 0 ) ) return false; // First output event is in Simulator
+    if( check ) return true;
+
+    m_outValue   = outValue;
+    m_nextOutVal = nextOutVal;
+    while( !m_outQueue.empty()  ) m_outQueue.pop();
+    while( !m_timeQueue.empty() ) m_timeQueue.pop();
+    for( uint out : outQueue ) m_outQueue.push( out );
+    for( quint64 time : timeQueue ) m_timeQueue.push( time );
+    return true;
+}
+
 void IoComponent::setInputHighV( double volt )
 {
     if( m_inHighV == volt ) return;
@@ -12,6 +12,7 @@
 
 class eElement;
 class IoPin;
+class QDataStream;
 
 class IoComponent : public Component
 {
@@ -28,6 +29,9 @@ class IoComponent : public Component
         void runOutputs();
         void scheduleOutPuts( eElement* el );
 
+        void saveOutState( QDataStream& s ); // Simulation checkpoint
+        bool loadOutState( QDataStream& s, bool check );
+
         double inputHighV() { return m_inHighV; }
         virtual void setInputHighV( double volt );
 
@@ -3,6 +3,8 @@
  *                                                                         *
  ***( see copyright.txt file at root folder )*******************************/
 
+#include <QDataStream>
+
 #include "bincounter.h"
 #include "itemlibrary.h"
 #include "connector.h"
@@ -75,6 +77,25 @@ void BinCounter::stamp()
     LogicComponent::stamp();
 }
 
+bool BinCounter::saveState( QDataStream& s )
+{
+    LogicComponent::saveState( s );
+    s << (qint32)m_Counter;
+    return true;
+}
+
+bool BinCounter::loadState( QDataStream& s, bool check )
+{
+    if( !LogicComponent::loadState( s, check ) ) return false;
+
+    qint32 counter;
+    s >> counter;
+    if( check || s.status() != QDataStream::Ok ) return s.status() == QDataStream::Ok;
+
+    m_Counter = counter;
+    return true;
+}
+
 void BinCounter::voltChanged()
 {
     updateClock();
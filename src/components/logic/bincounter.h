@@ -29,6 +29,8 @@ class BinCounter : public LogicComponent
         virtual void stamp() override;
         virtual void voltChanged() override;
         virtual void runEvent() override { IoComponent::runOutputs(); }
+        virtual bool saveState( QDataStream& s ) override;
+        virtual bool loadState( QDataStream& s, bool check ) override;
 
         int maxVal() { return m_TopValue; }
         void setMaxVal( int v ) { m_TopValue = v; }
@@ -28,6 +28,8 @@ class Bus : public Component, public eElement
         void setStartBit( int bit );
 
         virtual void registerEnode( eNode* enode, int n=-1 ) override;
+        virtual bool saveState( QDataStream& ) override { return true; }
+        virtual bool loadState( QDataStream&, bool ) override { return true; }
 
         virtual void paint( QPainter* p, const QStyleOptionGraphicsItem* option, QWidget* widget );
         
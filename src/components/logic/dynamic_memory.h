@@ -21,6 +21,7 @@ class DynamicMemory : public LogicComponent, public MemData
         static LibraryItem* libraryItem();
 
         virtual void stamp() override;
+        virtual bool saveState( QDataStream& ) override { return false; } // State not supported yet
         virtual void updateStep() override;
         virtual void voltChanged() override;
         virtual void runEvent() override;
@@ -3,6 +3,8 @@
  *                                                                         *
  ***( see copyright.txt file at root folder )*******************************/
 
+#include <QDataStream>
+
 #include "flipflopbase.h"
 #include "simulator.h"
 #include "circuit.h"
@@ -66,6 +68,25 @@ void FlipFlopBase::updateStep()
     Circuit::self()->update();
 }
 
+bool FlipFlopBase::saveState( QDataStream& s )
+{
+    LogicComponent::saveState( s );
+    s << m_Q0;
+    return true;
+}
+
+bool FlipFlopBase::loadState( QDataStream& s, bool check )
+{
+    if( !LogicComponent::loadState( s, check ) ) return false;
+
+    bool q0;
+    s >> q0;
+    if( check || s.status() != QDataStream::Ok ) return s.status() == QDataStream::Ok;
+
+    m_Q0 = q0;
+    return true;
+}
+
 void FlipFlopBase::voltChanged()
 {
     updateClock();  // Update Clk to don't miss any clock changes
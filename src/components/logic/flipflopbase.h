@@ -24,6 +24,8 @@ class FlipFlopBase : public LogicComponent
         virtual void updateStep() override;
         virtual void voltChanged() override;
         virtual void runEvent() override{ IoComponent::runOutputs(); }
+        virtual bool saveState( QDataStream& s ) override;
+        virtual bool loadState( QDataStream& s, bool check ) override;
 
         bool sPinState();
         bool rPinState();
@@ -107,6 +107,7 @@ Function::~Function(){}
 
 void Function::stamp()
 {
+    compileFunctions(); // Only builds if not done yet
     IoComponent::initState();
 
     for( uint i=0; i<m_inPin.size(); ++i ) m_inPin[i]->changeCallBack( this );
@@ -219,6 +220,13 @@ void Function::updateFunctions()
     m_script += "//----------------------;\n";
     /// qDebug() << m_script.toLocal8Bit().data();
 
+    if( Circuit::self()->loading() ) return; // Build once when Circuit is loaded
+    compileFunctions();
+}
+
+void Function::compileFunctions()
+{
+    m_voltChanged = NULL;
     int r = compileScript();
     if( r < 0 ) return;
 
@@ -50,6 +50,7 @@ class Function : public IoComponent, public ScriptBase
 
     private:
         void updateFunctions();
+        void compileFunctions();
         void updateArea( uint ins, uint outs );
 
         asIScriptFunction* m_voltChanged;
@@ -22,6 +22,7 @@ class I2CRam : public IoComponent, public TwiModule, public MemData
         static LibraryItem* libraryItem();
 
         virtual void stamp() override;
+        virtual bool saveState( QDataStream& ) override { return false; } // State not supported yet
         virtual void initialize() override;
         virtual void updateStep() override;
         virtual void voltChanged() override;
@@ -21,6 +21,7 @@ class I2CToParallel : public IoComponent, public TwiModule
  static LibraryItem* libraryItem();
 
         virtual void stamp() override;
+        virtual bool saveState( QDataStream& ) override { return false; } // State not supported yet
         virtual void voltChanged() override;
         virtual void writeByte() override;
         virtual void readByte() override;
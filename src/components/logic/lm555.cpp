@@ -3,6 +3,7 @@
  *                                                                         *
  ***( see copyright.txt file at root folder )*******************************/
 
+#include <QDataStream>
 #include <QtMath>
 #include <QPainter>
 
@@ -185,6 +186,25 @@ void Lm555::runEvent()
     m_resD.setRes( m_outState ? high_imp : 1 );
 }
 
+bool Lm555::saveState( QDataStream& s )
+{
+    s << m_outState << m_voltPos << m_voltNeg;
+    return true;
+}
+
+bool Lm555::loadState( QDataStream& s, bool check )
+{
+    bool outState;
+    double voltPos, voltNeg;
+    s >> outState >> voltPos >> voltNeg;
+    if( check || s.status() != QDataStream::Ok ) return s.status() == QDataStream::Ok;
+
+    m_outState = outState; // Output Pin and Discharge resistor restore their own state
+    m_voltPos  = voltPos;
+    m_voltNeg  = voltNeg;
+    return true;
+}
+
 void Lm555::paint( QPainter* p, const QStyleOptionGraphicsItem* o, QWidget* w )
 {
     Component::paint( p, o, w );
@@ -29,6 +29,9 @@ class Lm555 : public Component, public eElement
         virtual void stamp() override;
         virtual void voltChanged() override;
         virtual void runEvent() override;
+
+        virtual bool saveState( QDataStream& s ) override;
+        virtual bool loadState( QDataStream& s, bool check ) override;
         
         virtual void paint( QPainter* p, const QStyleOptionGraphicsItem* o, QWidget* w ) override;
 
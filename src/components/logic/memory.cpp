@@ -3,6 +3,7 @@
  *                                                                         *
  ***( see copyright.txt file at root folder )*******************************/
 
+#include <QDataStream>
 #include <math.h>
 
 #include "memory.h"
@@ -11,6 +12,7 @@
 #include "simulator.h"
 #include "circuit.h"
 #include "iopin.h"
+#include "ioport.h"
 #include "memtable.h"
 #include "utils.h"
 
@@ -130,6 +132,35 @@ void Memory::updateStep()
     if( m_memTable ) m_memTable->updateTable( &m_ram );
 }
 
+bool Memory::saveState( QDataStream& s )
+{
+    IoComponent::saveOutState( s );
+    s << m_ram << (qint32)m_address << m_oe << m_we << m_cs;
+    return true;
+}
+
+bool Memory::loadState( QDataStream& s, bool check )
+{
+    if( !IoComponent::loadOutState( s, check ) ) return false;
+
+    QVector<int> ram;
+    qint32 address;
+    bool oe, we, cs;
+    s >> ram >> address >> oe >> we >> cs;
+    if( s.status() != QDataStream::Ok || ram.size() != m_ram.size() ) return false;
+    if( check ) return true;
+
+    m_eElement = this; // Pending output events
+    m_ram = ram;
+    m_address = address;
+    m_oe = oe;
+    m_we = we;
+    m_cs = cs;
+    for( IoPin* pin : m_inPin  ) pin->changeCallBack( this, m_asynchro && m_cs );
+    for( IoPin* pin : m_outPin ) pin->changeCallBack( this, m_asynchro && m_cs && m_we );
+    return true;
+}
+
 void Memory::voltChanged()        // Some Pin Changed State, Manage it
 {
     bool cs = m_CsPin->getInpState();
@@ -171,6 +202,34 @@ void Memory::voltChanged()        // Some Pin Changed State, Manage it
         IoComponent::scheduleOutPuts( this );
 }   }
 
+Memory* Memory::busMemory( IoPort* addrPort, IoPort* dataPort, IoPin* csPin, IoPin* oePin, IoPin* wePin )
+{
+    Pin* pin = csPin->linkedPin();
+    if( !pin ) return NULL;
+
+    Memory* mem = dynamic_cast<Memory*>( pin->component() );
+    if( !mem || pin != mem->m_CsPin ) return NULL;
+    if( mem->m_dataBits != 8 || mem->m_invInputs || mem->m_invOutputs ) return NULL;
+    if( oePin->linkedPin() != mem->m_oePin || wePin->linkedPin() != mem->m_WePin ) return NULL;
+
+    for( int i=0; i<8; ++i )
+    {
+        IoPin* dataPin = dataPort->getPinN( i );
+        if( !dataPin || dataPin->linkedPin() != mem->m_outPin[i] ) return NULL;
+    }
+    int i = 0;
+    while( IoPin* addrPin = addrPort->getPinN( i ) )
+    {
+        if( i < mem->m_addrBits ){
+            if( addrPin->linkedPin() != mem->m_inPin[i] ) return NULL;
+        }
+        else if( addrPin->linkedPin() ) return NULL; // Upper address lines must be unused
+        i++;
+    }
+    if( i < mem->m_addrBits ) return NULL;
+    return mem;
+}
+
 void Memory::setAsynchro( bool a )
 {
     m_asynchro = a;
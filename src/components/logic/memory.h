@@ -11,6 +11,7 @@
 #include "memdata.h"
 
 class LibraryItem;
+class IoPort;
 
 class Memory : public IoComponent, public eElement, public MemData
 {
@@ -26,6 +27,9 @@ class Memory : public IoComponent, public eElement, public MemData
         virtual void voltChanged() override;
         virtual void runEvent() override { IoComponent::runOutputs(); }
 
+        virtual bool saveState( QDataStream& s ) override;
+        virtual bool loadState( QDataStream& s, bool check ) override;
+
         void setMem( QString m );
         QString getMem();
 
@@ -47,6 +51,11 @@ class Memory : public IoComponent, public eElement, public MemData
 
         void updatePins();
 
+        // Bus fast path: a CPU wired only to this Memory accesses it directly
+ static Memory* busMemory( IoPort* addrPort, IoPort* dataPort, IoPin* csPin, IoPin* oePin, IoPin* wePin );
+        int  readBus( int addr ) { return m_ram[addr & (m_ram.size()-1)]; }
+        void writeBus( int addr, int value ) { m_ram[addr & (m_ram.size()-1)] = value; }
+
     public slots:
         void loadData();
         void saveData();
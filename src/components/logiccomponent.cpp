@@ -3,6 +3,8 @@
  *                                                                         *
  ***( see copyright.txt file at root folder )*******************************/
 
+#include <QDataStream>
+
 #include "logiccomponent.h"
 #include "circuitwidget.h"
 #include "simulator.h"
@@ -41,6 +43,29 @@ void LogicComponent::stamp()
     m_outEnable = true;
 }
 
+bool LogicComponent::saveState( QDataStream& s )
+{
+    IoComponent::saveOutState( s );
+    s << m_clock << (qint32)m_clkState << m_outEnable;
+    return true;
+}
+
+bool LogicComponent::loadState( QDataStream& s, bool check )
+{
+    if( !IoComponent::loadOutState( s, check ) ) return false;
+
+    bool clock, outEnable;
+    qint32 clkState;
+    s >> clock >> clkState >> outEnable;
+    if( check || s.status() != QDataStream::Ok ) return s.status() == QDataStream::Ok;
+
+    m_eElement  = this; // Pending output events
+    m_clock     = clock;
+    m_clkState  = (clkState_t)clkState;
+    m_outEnable = outEnable;
+    return true;
+}
+
 std::vector<Pin*> LogicComponent::getPins()
 {
     std::vector<Pin*> pins = IoComponent::getPins();
@@ -27,6 +27,8 @@ class FreqMeter : public Component, public eElement
 
         double filter() { return m_filter; }
         void setFilter( double f ) { m_filter = f; }
+
+        double freq() { return m_freq; }
         
         virtual void paint( QPainter* p, const QStyleOptionGraphicsItem* option, QWidget* widget ) override;
         
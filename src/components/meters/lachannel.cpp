@@ -5,6 +5,7 @@
 
 #include "lachannel.h"
 #include "plotdisplay.h"
+#include "datacapture.h"
 #include "simulator.h"
 #include "pin.h"
 #include "utils.h"
@@ -77,6 +78,8 @@ void LaChannel::addReading( double v )
     if( ++m_bufferCounter >= m_buffer.size() ) m_bufferCounter = 0;
     m_buffer[m_bufferCounter] = v;
     m_time[m_bufferCounter] = simTime;
+
+    if( m_capture ) m_capture->addSample( simTime, m_channel, v );
 }
 
 void LaChannel::voltChanged()
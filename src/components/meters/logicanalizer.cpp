@@ -123,6 +123,8 @@ LAnalizer::~LAnalizer()
 
 void LAnalizer::updateStep()
 {
+    if( !Simulator::self()->isRunning() ) stopCapture();
+
     if( !Simulator::self()->isPaused() )
     {
         uint64_t simTime = Simulator::self()->circTime(); // free running
@@ -166,6 +168,7 @@ void LAnalizer::updateStep()
         }
         m_risEdge = 0;
     }
+    publishData();
     m_display->update();
 
     if( m_changed ){
@@ -254,6 +257,7 @@ void LAnalizer::setTimePos( int64_t tp )
     m_timePos = tp;
     for( int i=0; i<8; ++i ) m_display->setHPos( i, m_timePos );
     m_laWidget->updateTimePosBox( tp );
+    updateDisplay();
 }
 
 void LAnalizer::moveTimePos( int64_t delta )
@@ -261,6 +265,7 @@ void LAnalizer::moveTimePos( int64_t delta )
     m_timePos = m_timePos+delta;
     for( int i=0; i<8; ++i ) m_display->setHPos( i, m_timePos );
     m_laWidget->updateTimePosBox( m_timePos );
+    updateDisplay();
 }
 
 void LAnalizer::setVoltDiv( double )
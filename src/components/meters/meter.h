@@ -22,6 +22,8 @@ class Meter : public Component, public eResistor
         bool swithchPins() { return m_switchPins; }
         void setSwitchPins( bool s );
 
+        double value() { return m_dispValue; }
+
         virtual void initialize() override { m_crashed = false;}
         virtual void updateStep() override;
 
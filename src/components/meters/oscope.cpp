@@ -41,6 +41,7 @@ Oscope::Oscope( QString type, QString id )
       : PlotBase( type, id )
 {
     m_numChannels = 4;
+    m_analog  = true;
     m_trigger = 4;
     m_auto    = 4;
 
@@ -120,6 +121,8 @@ void Oscope::updateStep()
     uint64_t timeFrame = m_timeDiv*10;
     uint64_t simTime;
 
+    if( !Simulator::self()->isRunning() ) stopCapture();
+
     if( !Simulator::self()->isPaused() )
     {
         if( m_trigger < 4  ) period = m_channel[m_trigger]->m_period; // We want a trigger
@@ -161,6 +164,7 @@ void Oscope::updateStep()
             m_channel[i]->m_trigIndex = m_channel[i]->m_bufferCounter;
         }
     }
+    publishData();
     m_display->update();
 
     if( m_changed ){
@@ -328,6 +332,10 @@ void Oscope::setTimePos( int ch, int64_t tp )
     m_timePos[ch] = tp;
     m_display->setHPos( ch, tp );
     m_oscWidget->updateTimePosBox( ch, tp );
+
+    if( Simulator::self()->isRunning() ) return; // Published in next updateStep
+    publishChannel( ch );  // Other channels may not exist yet (constructor)
+    m_display->update();
 }
 
 void Oscope::moveTimePos( int64_t delta )
@@ -343,6 +351,7 @@ void Oscope::moveTimePos( int64_t delta )
         m_display->setHPos( i, m_timePos[i] );
         m_oscWidget->updateTimePosBox( i, m_timePos[i] );
     }
+    updateDisplay();
 }
 
 void Oscope::setVoltDiv( int ch, double vd )
@@ -6,6 +6,7 @@
 #include "oscopechannel.h"
 #include "oscope.h"
 #include "plotdisplay.h"
+#include "datacapture.h"
 #include "datawidget.h"
 #include "simulator.h"
 #include "e-pin.h"
@@ -150,6 +151,8 @@ void OscopeChannel::voltChanged()
     m_buffer[m_bufferCounter] = data;
     m_time[m_bufferCounter] = simTime;
 
+    if( m_capture ) m_capture->addSample( simTime, m_channel, data );
+
     if( delta > m_filter )               // Rising
     {
         //if( delta > m_filter )
@@ -22,8 +22,11 @@ class Probe : public Component, public eElement
  static LibraryItem* libraryItem();
 
         virtual void updateStep() override;
+        virtual bool saveState( QDataStream& ) override { return true; }
+        virtual bool loadState( QDataStream&, bool ) override { return true; }
 
         void setVolt( double volt );
+        double volt() { return m_voltIn; }
 
         double threshold() { return m_voltTrig; }
         void setThreshold( double t ) { m_voltTrig = t; }
@@ -26,6 +26,7 @@ class DS1307 : public Component, public TwiModule
 
         virtual void initialize() override;
         virtual void stamp() override;
+        virtual bool saveState( QDataStream& ) override { return false; } // State not supported yet
 
         virtual void writeByte() override;
         virtual void readByte() override;
@@ -27,6 +27,7 @@ class DS1621 : public IoComponent, public TwiModule
         void setTemp( double temp ) { m_temp = temp; }
 
         virtual void stamp() override;
+        virtual bool saveState( QDataStream& ) override { return false; } // State not supported yet
         virtual void runEvent() override;
         virtual void voltChanged() override;
 
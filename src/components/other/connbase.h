@@ -20,6 +20,8 @@ class ConnBase : public Component, public eElement
         void setSize( int size );
 
         virtual void registerEnode( eNode*, int n=-1 ) override;
+        virtual bool saveState( QDataStream& ) override { return true; }
+        virtual bool loadState( QDataStream&, bool ) override { return true; }
 
         virtual void setHidden( bool hid, bool hidArea=false, bool hidLabel=false ) override;
 
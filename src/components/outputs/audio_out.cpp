@@ -4,8 +4,11 @@
  ***( see copyright.txt file at root folder )*******************************/
 
 #include <QCoreApplication>
+#include <QDataStream>
+#include <QFileInfo>
 #include <QPainter>
 #include <QtMath>
+#include <QDir>
 
 #include "audio_out.h"
 #include "connector.h"
@@ -13,9 +16,13 @@
 #include "pin.h"
 #include "label.h"
 #include "simulator.h"
+#include "circuit.h"
 
 #include "doubleprop.h"
 #include "boolprop.h"
+#include "stringprop.h"
+
+#define recRate 44100 // Samples per second of recorded Wav files
 
 #define tr(str) simulideTr("AudioOut",str)
 
@@ -58,6 +65,18 @@ AudioOut::AudioOut( QString type, QString id )
     m_admit = 1.0/8;
     m_buzzer = false;
     m_audioOutput = NULL;
+    m_recStep = 1e12/recRate;
+
+    addPropGroup( { tr("Main"), {
+        new BoolProp<AudioOut>("Buzzer", tr("Buzzer"), ""
+                              , this, &AudioOut::buzzer, &AudioOut::setBuzzer ),
+
+        new DoubProp<AudioOut>("Impedance", tr("Impedance"), "Ω"
+                              , this, &AudioOut::res, &AudioOut::setResSafe ),
+
+        new StrProp <AudioOut>("Rec_File", tr("Record to Wav file"), ""
+                              , this, &AudioOut::recFile, &AudioOut::setRecFile )
+    },0} );
 
     m_deviceinfo = QAudioDeviceInfo::defaultOutputDevice(); 
     if( m_deviceinfo.isNull() ) 
@@ -95,82 +114,153 @@ AudioOut::AudioOut( QString type, QString id )
     }  
     m_audioOutput = new QAudioOutput( m_deviceinfo, m_format );
 
-    addPropGroup( { tr("Main"), {
-        new BoolProp<AudioOut>("Buzzer", tr("Buzzer"), ""
-                              , this, &AudioOut::buzzer, &AudioOut::setBuzzer ),
-
-        new DoubProp<AudioOut>("Impedance", tr("Impedance"), "Ω"
-                              , this, &AudioOut::res, &AudioOut::setResSafe )
-    },0} );
 }
 AudioOut::~AudioOut()
 {
+    stopRecord();
     if( m_audioOutput ) delete m_audioOutput;
 }
 
 void AudioOut::initialize()
 {
+    stopRecord();
+    Simulator::self()->cancelEvents( this );
+
     if( m_deviceinfo.isNull() ) return;
 
     m_dataBuffer.clear();
     m_audioOutput->stop();
     m_audioOutput->reset();
-
-    Simulator::self()->cancelEvents( this );
 }
 
 void AudioOut::stamp()
 {
     eResistor::stamp();
+    startRecord();
 
-    if( m_deviceinfo.isNull() ) return;
-
-    m_audioBuffer = m_audioOutput->start();
-    m_dataSize = m_audioOutput->periodSize();
-    m_dataBuffer.reserve( m_dataSize );
+    if( !m_deviceinfo.isNull() )
+    {
+        m_audioBuffer = m_audioOutput->start();
+        m_dataSize = m_audioOutput->periodSize();
+        m_dataBuffer.reserve( m_dataSize );
+        m_playTime = Simulator::self()->circTime();
+    }
+    else if( !m_wavOut.isOpen() ) return;
 
     if( m_ePin[0]->isConnected() && m_ePin[1]->isConnected() )
             Simulator::self()->addEvent( 1, this );
 }
 
-void AudioOut::runEvent()
+void AudioOut::runEvent() // Recording and playback have their own sample times
 {
     double voltPN = m_ePin[0]->getVoltage()-m_ePin[1]->getVoltage();
     int outVal = 128;
+    uint64_t time = Simulator::self()->circTime();
 
     if( m_buzzer){
         if( voltPN > 2.5 )
         {
             double stepsPC = 1e12/1000;
-            double time = Simulator::self()->circTime();
-            time = remainder( time, stepsPC );
-            time = qDegreesToRadians( time*360/stepsPC );
+            double t = remainder( time, stepsPC );
+            t = qDegreesToRadians( t*360/stepsPC );
 
-            outVal += sin( time )*128;
+            outVal += sin( t )*128;
     }   }
     else outVal += voltPN*51;
 
     if     ( outVal > 255 ) outVal = 255;
     else if( outVal < 0 )   outVal = 0;
 
-    m_dataBuffer.append( (char)outVal );
+    if( m_wavOut.isOpen() && time >= m_recTime ) recordSample( outVal );
 
-    if( m_dataBuffer.size() == m_dataSize )
+    bool playing = !m_deviceinfo.isNull();
+    if( playing && time >= m_playTime )
     {
-        //qDebug() <<"pushing"<<m_dataBuffer.size()<< m_audioOutput->bytesFree() ;
+        m_dataBuffer.append( (char)outVal );
 
-        m_audioBuffer->write( m_dataBuffer.data(), m_dataSize );
-        m_dataBuffer.clear();
+        if( m_dataBuffer.size() == m_dataSize )
+        {
+            //qDebug() <<"pushing"<<m_dataBuffer.size()<< m_audioOutput->bytesFree() ;
+
+            m_audioBuffer->write( m_dataBuffer.data(), m_dataSize );
+            m_dataBuffer.clear();
+        }
+        double realSpeed = Simulator::self()->realSpeed();
+        if( realSpeed < 1e-6 )
+        {
+            realSpeed = Simulator::self()->psPerSec();
+            realSpeed /= 1e8;
+        }
+        realSpeed *= (1e12/10000);
+        uint64_t playStep = realSpeed/m_format.sampleRate();//realSpeed*25*1e2;//(realSpeed/10000)*25*1e6
+        if( playStep < 1 ) playStep = 1;
+        m_playTime = time+playStep;
     }
-    double realSpeed = Simulator::self()->realSpeed();
-    if( realSpeed < 1e-6 )
+    uint64_t nextTime = playing ? m_playTime : m_recTime;
+    if( m_wavOut.isOpen() && m_recTime < nextTime ) nextTime = m_recTime;
+
+    Simulator::self()->addEvent( nextTime-time, this );
+}
+
+void AudioOut::startRecord()
+{
+    if( m_recFile.isEmpty() ) return;
+
+    QDir circuitDir = QFileInfo( Circuit::self()->getFilePath() ).absoluteDir();
+    m_wavOut.setFileName( circuitDir.absoluteFilePath( m_recFile ) );
+    if( !m_wavOut.open( QIODevice::WriteOnly | QIODevice::Truncate ) )
     {
-        realSpeed = Simulator::self()->psPerSec();
-        realSpeed /= 1e8;
+        qDebug() << "AudioOut::startRecord Error: can't open file" << m_wavOut.fileName();
+        return;
     }
-    realSpeed *= (1e12/10000);
-    uint64_t nextEvent = realSpeed/m_format.sampleRate();//realSpeed*25*1e2;//(realSpeed/10000)*25*1e6
-    Simulator::self()->addEvent( nextEvent, this ); // 25 us
+    writeWavHeader( 0 ); // Sizes are written when recording ends
+    m_recBuffer.clear();
+    m_recTime = Simulator::self()->circTime();
+    m_recSize = 0;
+}
+
+void AudioOut::stopRecord()
+{
+    if( !m_wavOut.isOpen() ) return;
+
+    m_wavOut.write( m_recBuffer );
+    m_recSize += m_recBuffer.size();
+    m_recBuffer.clear();
+
+    m_wavOut.seek( 0 );
+    writeWavHeader( m_recSize );
+    m_wavOut.close();
+}
+
+void AudioOut::recordSample( char val ) // Fixed sample rate in simulation time
+{
+    m_recBuffer.append( val );
+    m_recTime += m_recStep;
+
+    if( m_recBuffer.size() < 64*1024 ) return;
+    m_wavOut.write( m_recBuffer ); // Stream to file in chunks
+    m_recSize += m_recBuffer.size();
+    m_recBuffer.clear();
+}
+
+void AudioOut::writeWavHeader( uint32_t dataSize ) // PCM 8 bits unsigned, 1 channel
+{
+    QDataStream out( &m_wavOut );
+    out.setByteOrder( QDataStream::LittleEndian );
+
+    out.writeRawData( "RIFF", 4 );
+    out << (uint32_t)(36+dataSize); // File Size - 8
+    out.writeRawData( "WAVE", 4 );
+    out.writeRawData( "fmt ", 4 );
+    out << (uint32_t)16;            // Size of Format section
+    out << (uint16_t)1;             // Format type: PCM
+    out << (uint16_t)1;             // Number of channels
+    out << (uint32_t)recRate;       // Sample rate
+    out << (uint32_t)recRate;       // Byte rate
+    out << (uint16_t)1;             // Block size
+    out << (uint16_t)8;             // Bits per sample
+    out.writeRawData( "data", 4 );
+    out << dataSize;                // Size of Data section
 }
 
 /*void AudioOut::stateChanged( QAudio::State state )
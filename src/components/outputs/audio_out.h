@@ -7,6 +7,7 @@
 #define AUDIOOUT_H
 
 #include <QAudioOutput>
+#include <QFile>
 
 #include "e-resistor.h"
 #include "component.h"
@@ -28,11 +29,19 @@ class AudioOut : public Component, public eResistor
 
         bool buzzer() { return m_buzzer; }
         void setBuzzer( bool b ) { m_buzzer = b; }
+
+        QString recFile() { return m_recFile; }
+        void setRecFile( QString f ) { m_recFile = f; }
         
         virtual QPainterPath shape() const override;
         virtual void paint( QPainter* p, const QStyleOptionGraphicsItem* option, QWidget* widget ) override;
 
     private:
+        void startRecord();
+        void stopRecord();
+        void recordSample( char val );
+        void writeWavHeader( uint32_t dataSize );
+
         QAudioDeviceInfo m_deviceinfo;
         QAudioFormat     m_format;  
         
@@ -42,9 +51,17 @@ class AudioOut : public Component, public eResistor
 
         int m_dataSize;
         int m_dataCount;
+        uint64_t m_playTime;    // Time of next played sample
 
         bool m_started;
         bool m_buzzer;
+
+        QString    m_recFile;   // Wav file to record output
+        QFile      m_wavOut;
+        QByteArray m_recBuffer;
+        uint64_t   m_recTime;   // Time of next recorded sample
+        uint64_t   m_recStep;   // Simulation time between recorded samples
+        uint32_t   m_recSize;   // Samples written to file
 };
 
 #endif
@@ -3,6 +3,8 @@
  *                                                                         *
  ***( see copyright.txt file at root folder )*******************************/
 
+#include <QDataStream>
+
 #include "aip31068_i2c.h"
 #include "itemlibrary.h"
 #include "simulator.h"
@@ -46,6 +48,7 @@ Aip31068_i2c::Aip31068_i2c( QString type, QString id )
     TwiModule::setSclPin( m_clkPin );
 
     Simulator::self()->addToUpdateList( this );
+    setViewItem( this );
     
     Aip31068_i2c::initialize();
 
@@ -88,6 +91,28 @@ void Aip31068_i2c::voltChanged()             // Called when clock Pin changes
     if( m_i2cState == I2C_STOP ) m_phase = 3;
 }
 
+bool Aip31068_i2c::saveState( QDataStream& s )
+{
+    TwiModule::saveState( s );
+    saveDisplay( s );
+    s << m_controlByte << m_phase;
+    return true;
+}
+
+bool Aip31068_i2c::loadState( QDataStream& s, bool check )
+{
+    if( !TwiModule::loadState( s, check ) ) return false;
+    if( !loadDisplay( s, check ) ) return false;
+
+    int controlByte, phase;
+    s >> controlByte >> phase;
+    if( check || s.status() != QDataStream::Ok ) return s.status() == QDataStream::Ok;
+
+    m_controlByte = controlByte;
+    m_phase       = phase;
+    return true;
+}
+
 void Aip31068_i2c::startWrite() { m_phase = 0; }
 
 void Aip31068_i2c::readByte()
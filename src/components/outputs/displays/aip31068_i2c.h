@@ -26,6 +26,9 @@ class Aip31068_i2c : public Hd44780_Base, public TwiModule
         virtual void updateStep() override;
         virtual void voltChanged() override;
 
+        virtual bool saveState( QDataStream& s ) override;
+        virtual bool loadState( QDataStream& s, bool check ) override;
+
         virtual void startWrite() override;
         virtual void readByte() override;
 
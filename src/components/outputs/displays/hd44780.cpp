@@ -4,6 +4,7 @@
  ***( see copyright.txt file at root folder )*******************************/
 
 #include <math.h>
+#include <QDataStream>
 
 #include "hd44780.h"
 #include "itemlibrary.h"
@@ -53,6 +54,7 @@ Hd44780::Hd44780( QString type, QString id )
         initPuPin( i+3, "D"+QString::number(i), m_dataPin[i] );
     }
     Simulator::self()->addToUpdateList( this );
+    setViewItem( this );
     
     Hd44780::initialize();
 
@@ -125,6 +127,17 @@ void Hd44780::voltChanged()             // Called when clock Pin changes
     }
 }
 
+bool Hd44780::saveState( QDataStream& s )
+{
+    saveDisplay( s );
+    return true;
+}
+
+bool Hd44780::loadState( QDataStream& s, bool check )
+{
+    return loadDisplay( s, check );
+}
+
 void Hd44780::readData()
 {
 
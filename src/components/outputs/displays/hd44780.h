@@ -26,6 +26,9 @@ class Hd44780 : public Hd44780_Base, public eElement
         virtual void updateStep() override;
         virtual void voltChanged() override;
 
+        virtual bool saveState( QDataStream& s ) override;
+        virtual bool loadState( QDataStream& s, bool check ) override;
+
         void showPins( bool show );
 
     private:
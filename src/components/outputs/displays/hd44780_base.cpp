@@ -4,6 +4,7 @@
  ***( see copyright.txt file at root folder )*******************************/
 
 #include <QPainter>
+#include <QDataStream>
 
 #include "connector.h"
 #include "simulator.h"
@@ -53,6 +54,55 @@ void Hd44780_Base::init()
     clearLcd();
 }
 
+void Hd44780_Base::saveDisplay( QDataStream& s )
+{
+    for( int i=0; i<80; ++i ) s << m_DDram[i];
+    for( int i=0; i<64; ++i ) s << m_CGram[i];
+
+    s << m_cursPos << m_shiftPos << m_direction << m_shiftDisp << m_dispOn << m_cursorOn << m_cursorBlink;
+    s << m_dataLength << m_lineLength << m_DDaddr << m_CGaddr << m_nibble << m_input;
+    s << m_lastClock << m_writeDDRAM << m_blinking << (quint64)m_lastCircTime;
+}
+
+bool Hd44780_Base::loadDisplay( QDataStream& s, bool check )
+{
+    int DDram[80], CGram[64];
+    for( int i=0; i<80; ++i ) s >> DDram[i];
+    for( int i=0; i<64; ++i ) s >> CGram[i];
+
+    int cursPos, shiftPos, direction, shiftDisp, dispOn, cursorOn, cursorBlink;
+    int dataLength, lineLength, DDaddr, CGaddr, nibble, input;
+    bool lastClock, writeDDRAM, blinking;
+    quint64 lastCircTime;
+    s >> cursPos >> shiftPos >> direction >> shiftDisp >> dispOn >> cursorOn >> cursorBlink;
+    s >> dataLength >> lineLength >> DDaddr >> CGaddr >> nibble >> input;
+    s >> lastClock >> writeDDRAM >> blinking >> lastCircTime;
+    if( check || s.status() != QDataStream::Ok ) return s.status() == QDataStream::Ok;
+
+    memcpy( m_DDram, DDram, sizeof(m_DDram) );
+    memcpy( m_CGram, CGram, sizeof(m_CGram) );
+
+    m_cursPos      = cursPos;
+    m_shiftPos     = shiftPos;
+    m_direction    = direction;
+    m_shiftDisp    = shiftDisp;
+    m_dispOn       = dispOn;
+    m_cursorOn     = cursorOn;
+    m_cursorBlink  = cursorBlink;
+    m_dataLength   = dataLength;
+    m_lineLength   = lineLength;
+    m_DDaddr       = DDaddr;
+    m_CGaddr       = CGaddr;
+    m_nibble       = nibble;
+    m_input        = input;
+    m_lastClock    = lastClock;
+    m_writeDDRAM   = writeDDRAM;
+    m_blinking     = blinking;
+    m_lastCircTime = lastCircTime;
+    update();
+    return true;
+}
+
 void Hd44780_Base::writeData( int data )
 {
     if( m_writeDDRAM )                                 // Write to DDRAM
@@ -4,6 +4,7 @@
  ***( see copyright.txt file at root folder )*******************************/
 
 #include <QPainter>
+#include <QDataStream>
 
 #include "ili9341.h"
 #include "itemlibrary.h"
@@ -65,6 +66,7 @@ Ili9341::Ili9341( QString type, QString id )
     m_clkPin = &m_pinSck;
 
     Simulator::self()->addToUpdateList( this );
+    setDirtyDriven( true );
     
     setLabelPos(-32,-180, 0);
     setShowId( true );
@@ -90,7 +92,95 @@ void Ili9341::initialize()
 
 void Ili9341::updateStep()
 {
-    update();
+    if( m_dirtyX1 < m_dirtyX0 ) return; // Nothing changed
+
+    update( QRectF( -120+m_dirtyX0, -162+m_dirtyY0, m_dirtyX1-m_dirtyX0+1, m_dirtyY1-m_dirtyY0+1 ) );
+
+    m_dirtyX0 = 239; m_dirtyX1 = 0;
+    m_dirtyY0 = 319; m_dirtyY1 = 0;
+}
+
+void Ili9341::setDirty( int x, int y )
+{
+    if( x < m_dirtyX0 ) m_dirtyX0 = x;
+    if( x > m_dirtyX1 ) m_dirtyX1 = x;
+    if( y < m_dirtyY0 ) m_dirtyY0 = y;
+    if( y > m_dirtyY1 ) m_dirtyY1 = y;
+    Updatable::setDirty();
+}
+
+void Ili9341::setAllDirty()
+{
+    m_dirtyX0 = 0; m_dirtyX1 = 239;
+    m_dirtyY0 = 0; m_dirtyY1 = 319;
+    Updatable::setDirty();
+}
+
+bool Ili9341::saveState( QDataStream& s )
+{
+    s << QByteArray( (const char*)m_aDispRam, sizeof(m_aDispRam) );
+    s << m_clock << (qint32)m_clkState << m_rxReg << m_inBit << m_inByte << m_data << m_dataBytes;
+    s << m_addrX << m_addrY << m_startX << m_endX << m_startY << m_endY << m_maxX << m_maxY << m_dirX << m_dirY;
+    s << m_startLin << m_lastCommand << m_readBytes;
+    s << m_scrollStartPage << m_scrollEndPage << m_scrollInterval << m_scrollVertOffset << m_scrollCount;
+    s << m_dispOn << m_dispInv << m_scroll << m_scrollR << m_scrollV << m_RGB;
+    return true;
+}
+
+bool Ili9341::loadState( QDataStream& s, bool check )
+{
+    QByteArray ram;
+    bool clock, dispOn, dispInv, scroll, scrollR, scrollV, RGB;
+    qint32 clkState;
+    unsigned char rxReg;
+    uint data;
+    int inBit, inByte, dataBytes;
+    int addrX, addrY, startX, endX, startY, endY, maxX, maxY, dirX, dirY;
+    int startLin, lastCommand, readBytes;
+    int scrollStartPage, scrollEndPage, scrollInterval, scrollVertOffset, scrollCount;
+    s >> ram;
+    s >> clock >> clkState >> rxReg >> inBit >> inByte >> data >> dataBytes;
+    s >> addrX >> addrY >> startX >> endX >> startY >> endY >> maxX >> maxY >> dirX >> dirY;
+    s >> startLin >> lastCommand >> readBytes;
+    s >> scrollStartPage >> scrollEndPage >> scrollInterval >> scrollVertOffset >> scrollCount;
+    s >> dispOn >> dispInv >> scroll >> scrollR >> scrollV >> RGB;
+    if( s.status() != QDataStream::Ok || ram.size() != sizeof(m_aDispRam) ) return false;
+    if( check ) return true;
+
+    memcpy( m_aDispRam, ram.constData(), ram.size() );
+    m_clock     = clock;
+    m_clkState  = (clkState_t)clkState;
+    m_rxReg     = rxReg;
+    m_inBit     = inBit;
+    m_inByte    = inByte;
+    m_data      = data;
+    m_dataBytes = dataBytes;
+    m_addrX  = addrX;
+    m_addrY  = addrY;
+    m_startX = startX;
+    m_endX   = endX;
+    m_startY = startY;
+    m_endY   = endY;
+    m_maxX   = maxX;
+    m_maxY   = maxY;
+    m_dirX   = dirX;
+    m_dirY   = dirY;
+    m_startLin    = startLin;
+    m_lastCommand = lastCommand;
+    m_readBytes   = readBytes;
+    m_scrollStartPage  = scrollStartPage;
+    m_scrollEndPage    = scrollEndPage;
+    m_scrollInterval   = scrollInterval;
+    m_scrollVertOffset = scrollVertOffset;
+    m_scrollCount      = scrollCount;
+    m_dispOn  = dispOn;
+    m_dispInv = dispInv;
+    m_scroll  = scroll;
+    m_scrollR = scrollR;
+    m_scrollV = scrollV;
+    m_RGB     = RGB;
+    setAllDirty();
+    return true;
 }
 
 void Ili9341::voltChanged()
@@ -143,7 +233,8 @@ void Ili9341::voltChanged()
                     //if( m_RGB ) { red  = B1; green = B2; blue = B3; }
                     //else        { blue = B1; green = B2; red  = B3; }
                     red  = B1; green = B2; blue = B3;
-                    m_aDispRam[m_addrX][m_addrY] = red+green+blue;
+                    m_aDispRam[m_addrY][m_addrX] = 0xFF000000 | (red+green+blue);
+                    setDirty( m_addrX, m_addrY );
                     incrementPointer();
                     m_data = 0;
                 }
@@ -249,8 +340,8 @@ void Ili9341::proccessCommand()
         case 0x20: m_dispInv = false; break; // Display Inversion Off
         case 0x21: m_dispInv = true; break;  // Display Inversion On
         case 0x26: m_readBytes = 1; break;   // Gamma Set
-        case 0x28: m_dispOn = false; break;  // Display Off
-        case 0x29: m_dispOn = true; break;   // Display On
+        case 0x28: m_dispOn = false; setAllDirty(); break; // Display Off
+        case 0x29: m_dispOn = true;  setAllDirty(); break; // Display On
         case 0x2A: m_readBytes = 4; break;   // Column Address Set
         case 0x2B: m_readBytes = 4; break;   // Page Address Set
         //case 0x2C: // Memory Write
@@ -327,7 +418,8 @@ void Ili9341::clearDDRAM()
 {
     for( int row=0; row<320; row++ )
         for( int col=0; col<240; col++ )
-            m_aDispRam[col][row] = 0;
+            m_aDispRam[row][col] = 0xFF000000;
+    setAllDirty();
 }
 
 void Ili9341::incrementPointer() 
@@ -395,6 +487,7 @@ void Ili9341::reset()
     m_lastCommand = 0;
 
     //m_reset = true;
+    setAllDirty();
 }
 
 void Ili9341::paint( QPainter* p, const QStyleOptionGraphicsItem* option, QWidget* widget )
@@ -407,23 +500,9 @@ void Ili9341::paint( QPainter* p, const QStyleOptionGraphicsItem* option, QWidge
     p->drawRoundedRect( m_area,2,2 );
 
     if( !m_dispOn ) p->fillRect(-120,-162, 240, 320, Qt::black ); // Display Off
-    else{
-        QImage img( 240*2, 320*2, QImage::Format_RGB32 );
-        QPainter painter;
-        painter.begin( &img );
-        painter.setRenderHint( QPainter::Antialiasing, true );
-
-        for( int row=0; row<=319; row++ )
-        {
-            int y = row*2;
-            for( int col=0; col<=239; col++ )
-            {
-                uint pixel = m_aDispRam[col][row];
-                painter.fillRect( col*2, y, 2, 2, QColor(pixel).rgb() );
-        }   }
-
-        painter.end();
-        p->drawImage(QRectF(-120,-162, 240, 320), img );
+    else{   // Wrap DDRAM, no copy
+        QImage img( (const uchar*)m_aDispRam, 240, 320, 240*4, QImage::Format_RGB32 );
+        p->drawImage( QRectF(-120,-162, 240, 320), img );
     }
 
     Component::paintSelected( p );
@@ -25,6 +25,9 @@ class Ili9341 : public Component, public eClockedDevice
         virtual void initialize() override;
         virtual void voltChanged() override;
         virtual void updateStep() override;
+
+        virtual bool saveState( QDataStream& s ) override;
+        virtual bool loadState( QDataStream& s, bool check ) override;
         
         virtual void paint( QPainter* p, const QStyleOptionGraphicsItem* option, QWidget* widget ) override;
 
@@ -35,9 +38,16 @@ class Ili9341 : public Component, public eClockedDevice
         void incrementY();
         void reset();
         void clearDDRAM();
+        void setDirty( int x, int y );
+        void setAllDirty();
 
         unsigned char m_rxReg;     // Received value
-        unsigned int m_aDispRam[240][320]; // DDRAM
+        unsigned int m_aDispRam[320][240]; // DDRAM: RGB32 framebuffer [row][col]
+
+        int m_dirtyX0;     // Dirty rectangle since last repaint
+        int m_dirtyX1;
+        int m_dirtyY0;
+        int m_dirtyY1;
 
         int m_inBit;        //How many bits have we read since last byte
         int m_inByte;
@@ -5,6 +5,7 @@
 
 #include <QPainter>
 #include <math.h>
+#include <QDataStream>
 
 #include "ks0108.h"
 #include "itemlibrary.h"
@@ -40,6 +41,7 @@ Ks0108::Ks0108( QString type, QString id )
 {
     m_area = QRectF( -74, -52, 148, 100 );
     m_graphical = true;
+    m_image = QImage( 128, 64, QImage::Format_RGB32 );
     m_csActLow = false;
     
     m_pinRst.setLabelText( "RST" );
@@ -69,6 +71,7 @@ Ks0108::Ks0108( QString type, QString id )
     m_pin[13] = &m_pinDC;
 
     Simulator::self()->addToUpdateList( this );
+    setDirtyDriven( true );
     
     setLabelPos( -32,-68, 0);
     setShowId( true );
@@ -99,9 +102,64 @@ void Ks0108::stamp()
 
 void Ks0108::updateStep()
 {
+    updateImage();
     update();
 }
 
+void Ks0108::updateImage()
+{
+    m_image.fill( QColor(200,215,180) );
+    if( !m_dispOn ) return;
+
+    QRgb black = QColor( Qt::black ).rgb();
+
+    for(int row=0;row<8;row++){
+        for( int col=0; col<128; col++ )
+        {
+            char abyte = m_aDispRam[row][col];
+
+            for( int bit=0; bit<8; bit++ )
+            {
+                if( abyte & 1 ) ((QRgb*)m_image.scanLine( row*8+bit ))[col] = black;
+                abyte >>= 1;
+}   }   }   }
+
+bool Ks0108::saveState( QDataStream& s )
+{
+    s << QByteArray( (const char*)m_aDispRam, sizeof(m_aDispRam) );
+    s << m_input << m_addrX1 << m_addrY1 << m_addrX2 << m_addrY2 << m_startLin;
+    s << m_Cs1 << m_Cs2 << m_dispOn << m_lastScl << m_reset << m_Write;
+    return true;
+}
+
+bool Ks0108::loadState( QDataStream& s, bool check )
+{
+    QByteArray ram;
+    int input, addrX1, addrY1, addrX2, addrY2, startLin;
+    bool cs1, cs2, dispOn, lastScl, reset, write;
+    s >> ram;
+    s >> input >> addrX1 >> addrY1 >> addrX2 >> addrY2 >> startLin;
+    s >> cs1 >> cs2 >> dispOn >> lastScl >> reset >> write;
+    if( s.status() != QDataStream::Ok || ram.size() != sizeof(m_aDispRam) ) return false;
+    if( check ) return true;
+
+    memcpy( m_aDispRam, ram.constData(), ram.size() );
+    m_input    = input;
+    m_addrX1   = addrX1;
+    m_addrY1   = addrY1;
+    m_addrX2   = addrX2;
+    m_addrY2   = addrY2;
+    m_startLin = startLin;
+    m_Cs1      = cs1;
+    m_Cs2      = cs2;
+    m_dispOn   = dispOn;
+    m_lastScl  = lastScl;
+    m_reset    = reset;
+    m_Write    = write;
+    setDirty();
+    return true;
+}
+
 void Ks0108::voltChanged()                 // Called when En Pin changes 
 {
     if( m_pinRst.getVoltage()<2.5 ) reset();            // Reset Pin is Low
@@ -181,6 +239,7 @@ void Ks0108::writeData( int data )
 {
     if( m_Cs1 ) m_aDispRam[m_addrX1][m_addrY1]    = data;  // Write Half 1
     if( m_Cs2 ) m_aDispRam[m_addrX2][m_addrY2+64] = data;  // Write Half 2
+    setDirty();
     incrementPointer();
 }
 
@@ -194,7 +253,7 @@ void Ks0108::proccessCommand( int command )
     if( command<192 ) { setXaddr( command & 7 );  return; } //10111...  // Set X address     
     else              { startLin( command & 63 ); return; } //11......  // Set Display Start Line
 }
-void Ks0108::dispOn( int state ) { m_dispOn = (state > 0); }
+void Ks0108::dispOn( int state ) { m_dispOn = (state > 0); setDirty(); }
 
 void Ks0108::setYaddr( int addr )
 {
@@ -213,6 +272,7 @@ void Ks0108::clearDDRAM()
     for(int row=0;row<8;row++) 
         for( int col=0;col<128;col++ ) 
             m_aDispRam[row][col] = 0;
+    setDirty();
 }
 
 void Ks0108::incrementPointer() 
@@ -235,6 +295,7 @@ void Ks0108::reset()
     m_startLin = 0;
     m_dispOn = false;
     m_reset  = true;
+    setDirty();
 }
 
 void Ks0108::paint( QPainter* p, const QStyleOptionGraphicsItem* option, QWidget* widget )
@@ -249,31 +310,7 @@ void Ks0108::paint( QPainter* p, const QStyleOptionGraphicsItem* option, QWidget
     p->setBrush( QColor(200, 220, 180) );
     p->drawRoundedRect( -70, -48, 140, 76, 8, 8 );
 
-    if( !m_dispOn ) p->fillRect(-64,-42, 128, 64, QColor(200,215,180) );
-    else{
-        QImage img( 128*3, 64*3, QImage::Format_RGB32 );
-        QPainter painter;
-        painter.begin( &img );
-        painter.fillRect( 0, 0, 128*3, 64*3, QColor(200,215,180) );
-
-        for(int row=0;row<8;row++){
-            for( int col=0; col<128; col++ )
-            {
-                int x = col*3;
-                char abyte = m_aDispRam[row][col];
-
-                for( int bit=0; bit<8; bit++ )
-                {
-                    if( abyte & 1 ){
-                        int y = row*8+bit;
-                        painter.fillRect( x, y*3, 3, 3, Qt::black );
-                    }
-                    abyte >>= 1;
-        }   }   }
-
-        painter.end();
-        p->drawImage(QRectF(-64,-42, 128, 64), img );
-    }
+    p->drawImage( QRectF(-64,-42, 128, 64), m_image );
 
     Component::paintSelected( p );
 }
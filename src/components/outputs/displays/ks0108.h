@@ -6,6 +6,8 @@
 #ifndef KS0108_H
 #define KS0108_H
 
+#include <QImage>
+
 #include "component.h"
 #include "e-element.h"
 #include "iopin.h"
@@ -26,6 +28,9 @@ class Ks0108 : public Component, public eElement
         virtual void updateStep() override;
         virtual void voltChanged() override;
 
+        virtual bool saveState( QDataStream& s ) override;
+        virtual bool loadState( QDataStream& s, bool check ) override;
+
         void setCsActLow( bool low ) { m_csActLow = low; }
         bool csActLow() { return m_csActLow; }
         
@@ -42,10 +47,13 @@ class Ks0108 : public Component, public eElement
         void setXaddr( int addr );
         void startLin( int line ) { m_startLin = line; }
         void clearDDRAM();
+        void updateImage();
         void incrementPointer();
         void reset();
 
         unsigned char m_aDispRam[8][128];                 //128x64 DDRAM
+
+        QImage m_image;  // Rendered at updateStep only if DDRAM or state changed
         
         int m_input;
         int m_addrX1;                                   // X RAM address
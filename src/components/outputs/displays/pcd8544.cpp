@@ -14,6 +14,7 @@
 // Copyright: See COPYING file that comes with this distribution
 
 #include <QPainter>
+#include <QDataStream>
 
 #include "itemlibrary.h"
 #include "connector.h"
@@ -43,6 +44,7 @@ Pcd8544::Pcd8544( QString type, QString id )
        , m_pScl( 270, QPoint( 32, 40), id+"-PinScl", 0, this )
 {
     m_graphical = true;
+    m_image = QImage( 84, 48, QImage::Format_RGB32 );
 
     m_area = QRectF( -52, -52, 104, 84 );
 
@@ -60,6 +62,7 @@ Pcd8544::Pcd8544( QString type, QString id )
     m_pScl.setLabelText("CLK");
 
     Simulator::self()->addToUpdateList( this );
+    setDirtyDriven( true );
     
     setLabelPos( -32,-66, 0);
     setShowId( true );
@@ -84,9 +87,68 @@ void Pcd8544::initialize()
 
 void Pcd8544::updateStep()
 {
+    updateImage();
     update();
 }
 
+void Pcd8544::updateImage()
+{
+    QRgb background = QColor(200,215,180).rgb();
+
+    if     ( m_bPD )          m_image.fill( background ); // Power-Down mode
+    else if( !m_bD && !m_bE ) m_image.fill( background ); // Blank Display mode, blank the visuals
+    else if( !m_bD &&  m_bE ) m_image.fill( Qt::black );  // All segments on
+    else{
+        m_image.fill( background );
+        QRgb black = QColor( Qt::black ).rgb();
+
+        for(int row=0;row<6;row++){
+            for( int col=0; col<84; col++ )
+            {
+                char abyte = m_aDispRam[row][col];
+                if( m_bD && m_bE ) abyte = ~abyte; // Display Inverted
+
+                for( int bit=0; bit<8; bit++ )
+                {
+                    if( abyte & 1 ) ((QRgb*)m_image.scanLine( row*8+bit ))[col] = black;
+                    abyte >>= 1;
+}   }   }   }   }
+
+bool Pcd8544::saveState( QDataStream& s )
+{
+    s << QByteArray( (const char*)m_aDispRam, sizeof(m_aDispRam) );
+    s << m_bPD << m_bV << m_bH << m_bD << m_bE << m_lastScl;
+    s << m_addrX << m_addrY << m_inBit << m_cinBuf;
+    return true;
+}
+
+bool Pcd8544::loadState( QDataStream& s, bool check )
+{
+    QByteArray ram;
+    bool bPD, bV, bH, bD, bE, lastScl;
+    int addrX, addrY, inBit;
+    unsigned char cinBuf;
+    s >> ram;
+    s >> bPD >> bV >> bH >> bD >> bE >> lastScl;
+    s >> addrX >> addrY >> inBit >> cinBuf;
+    if( s.status() != QDataStream::Ok || ram.size() != sizeof(m_aDispRam) ) return false;
+    if( check ) return true;
+
+    memcpy( m_aDispRam, ram.constData(), ram.size() );
+    m_bPD     = bPD;
+    m_bV      = bV;
+    m_bH      = bH;
+    m_bD      = bD;
+    m_bE      = bE;
+    m_lastScl = lastScl;
+    m_addrX   = addrX;
+    m_addrY   = addrY;
+    m_inBit   = inBit;
+    m_cinBuf  = cinBuf;
+    setDirty();
+    return true;
+}
+
 void Pcd8544::voltChanged()               // Called when Scl, Rst or Cs Pin changes
 {
     if( m_pRst.getVoltage()<0.3 )            // Reset Pin is Low
@@ -114,6 +176,7 @@ void Pcd8544::voltChanged()               // Called when Scl, Rst or Cs Pin chan
     
     if( m_inBit == 7 ) 
     {
+        setDirty();
         if( m_pDc.getVoltage()>1.6 )                        // Write Data
         {
             //qDebug() << "Pcd8544::setVChanged"<< m_addrY<<m_addrX<< m_cinBuf;
@@ -165,6 +228,7 @@ void Pcd8544::clearDDRAM()
     for(int row=0; row<6; row++)
         for( int col=0; col<84; col++ )
             m_aDispRam[row][col] = 0;
+    setDirty();
 }
 
 void Pcd8544::incrementPointer() 
@@ -191,6 +255,7 @@ void Pcd8544::reset()
     m_bH  = false;
     m_bE  = false;
     m_bD  = false;
+    setDirty();
 }
 
 void Pcd8544::paint( QPainter* p, const QStyleOptionGraphicsItem* option, QWidget* widget )
@@ -205,34 +270,7 @@ void Pcd8544::paint( QPainter* p, const QStyleOptionGraphicsItem* option, QWidge
     p->setBrush( QColor(200, 220, 180) );
     p->drawRoundedRect( -48, -48, 96, 60, 8, 8 );
 
-    if     ( m_bPD )          p->fillRect(-42,-42, 84, 48, QColor(200,215,180) ); // Power-Down mode
-    else if( !m_bD && !m_bE ) p->fillRect(-42,-42, 84, 48, QColor(200,215,180) ); // Blank Display mode, blank the visuals
-    else if( !m_bD &&  m_bE ) p->fillRect(-42,-42, 84, 48, Qt::black );           // All segments on
-    else{
-        QImage img( 84*3, 48*3, QImage::Format_RGB32 );
-        QPainter painter;
-        painter.begin( &img );
-        painter.fillRect( 0, 0, 84*3, 48*3, QColor(200,215,180) );
-
-        for(int row=0;row<6;row++){
-            for( int col=0; col<84; col++ )
-            {
-                int x = col*3;
-                char abyte = m_aDispRam[row][col];
-                if( m_bD && m_bE ) abyte = ~abyte; // Display Inverted
-
-                for( int bit=0; bit<8; bit++ )
-                {
-                    if( abyte & 1 ){
-                        int y = row*8+bit;
-                        painter.fillRect( x, y*3, 3, 3, Qt::black );
-                    }
-                    abyte >>= 1;
-        }   }   }
-
-        painter.end();
-        p->drawImage(QRectF(-42,-42, 84, 48), img );
-    }
+    p->drawImage( QRectF(-42,-42, 84, 48), m_image );
 
     Component::paintSelected( p );
 }
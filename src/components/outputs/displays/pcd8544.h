@@ -17,6 +17,8 @@
 #ifndef PCD8544_H
 #define PCD8544_H
 
+#include <QImage>
+
 #include "component.h"
 #include "itemlibrary.h"
 #include "e-element.h"
@@ -35,6 +37,9 @@ class Pcd8544 : public Component, public eElement
         virtual void initialize() override;
         virtual void voltChanged() override;
         virtual void updateStep() override;
+
+        virtual bool saveState( QDataStream& s ) override;
+        virtual bool loadState( QDataStream& s, bool check ) override;
         
         virtual void paint( QPainter* p, const QStyleOptionGraphicsItem* option, QWidget* widget ) override;
 
@@ -43,9 +48,12 @@ class Pcd8544 : public Component, public eElement
         void incrementPointer();
         void reset();
         void clearDDRAM();
+        void updateImage();
 
         unsigned char m_aDispRam[6][84];                   //84x48 DDRAM
 
+        QImage m_image;  // Rendered at updateStep only if DDRAM or state changed
+
         //Controller state
         bool m_bPD;
         bool m_bV;
@@ -4,6 +4,7 @@
  ***( see copyright.txt file at root folder )*******************************/
 
 #include <QPainter>
+#include <QDataStream>
 
 #include "ssd1306.h"
 #include "itemlibrary.h"
@@ -73,8 +74,10 @@ Ssd1306::Ssd1306( QString type, QString id )
 
     m_dColor = White;
     m_rotate = true;
+    setDirty();
     
     Simulator::self()->addToUpdateList( this );
+    setDirtyDriven( true );
     
     setLabelPos(-32,-60, 0);
     setShowId( true );
@@ -153,12 +156,14 @@ void Ssd1306::reset()
     m_scroll   = false;
     m_scrollR  = false;
     m_scrollV  = false;
+    setDirty();
 }
 
 void Ssd1306::updateStep()
 {
     if( m_scroll )
     {
+        setDirty(); // Scroll runs at GUI update rate: keep updating
         m_scrollCount--;
         if( m_scrollCount <= 0 )
         {
@@ -178,11 +183,76 @@ void Ssd1306::updateStep()
                     }else{
                         if( col < 127  ) m_aDispRam[col][row] = m_aDispRam[col+1][row];
                         if( col == 127 ) m_aDispRam[col][row] = start;
-    }   }   }   }   }
-
+    }   }   }   }
+    updateImage();
     update();
 }
 
+bool Ssd1306::saveState( QDataStream& s )
+{
+    TwiModule::saveState( s );
+    s << QByteArray( (const char*)m_aDispRam, sizeof(m_aDispRam) );
+    s << m_cdr << m_mr << m_fosc << m_frm;
+    s << m_addrX << m_addrY << m_startX << m_endX << m_startY << m_endY << m_startLin << m_addrMode << m_lastCommand;
+    s << m_scrollStartPage << m_scrollEndPage << m_scrollInterval << m_scrollVertOffset << m_scrollCount << m_readBytes;
+    s << m_dispOn << m_dispFull << m_dispInv << m_scanInv << m_command << m_data << m_continue;
+    s << m_scroll << m_scrollR << m_scrollV;
+    return true;
+}
+
+bool Ssd1306::loadState( QDataStream& s, bool check )
+{
+    if( !TwiModule::loadState( s, check ) ) return false;
+
+    QByteArray ram;
+    int cdr, mr, fosc, frm;
+    int addrX, addrY, startX, endX, startY, endY, startLin, addrMode, lastCommand;
+    int scrollStartPage, scrollEndPage, scrollInterval, scrollVertOffset, scrollCount, readBytes;
+    bool dispOn, dispFull, dispInv, scanInv, command, data, cont;
+    bool scroll, scrollR, scrollV;
+    s >> ram;
+    s >> cdr >> mr >> fosc >> frm;
+    s >> addrX >> addrY >> startX >> endX >> startY >> endY >> startLin >> addrMode >> lastCommand;
+    s >> scrollStartPage >> scrollEndPage >> scrollInterval >> scrollVertOffset >> scrollCount >> readBytes;
+    s >> dispOn >> dispFull >> dispInv >> scanInv >> command >> data >> cont;
+    s >> scroll >> scrollR >> scrollV;
+    if( s.status() != QDataStream::Ok || ram.size() != sizeof(m_aDispRam) ) return false;
+    if( check ) return true;
+
+    memcpy( m_aDispRam, ram.constData(), ram.size() );
+    m_cdr  = cdr;
+    m_mr   = mr;
+    m_fosc = fosc;
+    m_frm  = frm;
+    m_addrX       = addrX;
+    m_addrY       = addrY;
+    m_startX      = startX;
+    m_endX        = endX;
+    m_startY      = startY;
+    m_endY        = endY;
+    m_startLin    = startLin;
+    m_addrMode    = addrMode;
+    m_lastCommand = lastCommand;
+    m_scrollStartPage  = scrollStartPage;
+    m_scrollEndPage    = scrollEndPage;
+    m_scrollInterval   = scrollInterval;
+    m_scrollVertOffset = scrollVertOffset;
+    m_scrollCount      = scrollCount;
+    m_readBytes        = readBytes;
+    m_dispOn   = dispOn;
+    m_dispFull = dispFull;
+    m_dispInv  = dispInv;
+    m_scanInv  = scanInv;
+    m_command  = command;
+    m_data     = data;
+    m_continue = cont;
+    m_scroll   = scroll;
+    m_scrollR  = scrollR;
+    m_scrollV  = scrollV;
+    setDirty();
+    return true;
+}
+
 void Ssd1306::startWrite()
 {
     m_command = false;
@@ -218,11 +288,14 @@ void Ssd1306::readByte()
 void Ssd1306::writeData()
 {
     m_aDispRam[m_addrX][m_addrY] = m_rxReg;
+    setDirty();
     incrementPointer();
 }
 
 void Ssd1306::proccessCommand()
 {
+    setDirty();
+
     if( m_readBytes > 0 )
     {
         if( m_lastCommand == 0x20 ) m_addrMode = m_rxReg;
@@ -364,6 +437,7 @@ void Ssd1306::clearDDRAM()
     for( int row=0; row<8; row++ )
         for( int col=0; col<128; col++ )
             m_aDispRam[col][row] = 0;
+    setDirty();
 }
 
 void Ssd1306::incrementPointer() 
@@ -397,6 +471,7 @@ void Ssd1306::setColorStr( QString color )
     if( c == White )  m_foreground = QColor(245, 245, 245);
     if( c == Blue  )  m_foreground = QColor(200, 200, 255);
     if( c == Yellow ) m_foreground = QColor(245, 245, 100);
+    setDirty();
 
     if( m_showVal && (m_showProperty == "Color") )
         setValLabelText( m_enumNames.at( c ) );
@@ -427,9 +502,45 @@ void Ssd1306::updateSize()
     m_clkPin->isMoved();
     m_pinSda->setPos( QPoint(-40, m_height/2+16) );
     m_pinSda->isMoved();
+    setDirty();
+    if( !Simulator::self()->isRunning() ) updateStep();
     Circuit::self()->update();
 }
 
+void Ssd1306::updateImage()
+{
+    if( m_image.width() != m_width || m_image.height() != m_height )
+        m_image = QImage( m_width, m_height, QImage::Format_RGB32 );
+
+    QRgb foreground = m_foreground.rgb();
+    if( m_dispFull ) { m_image.fill( foreground ); return; }
+
+    m_image.fill( Qt::black );
+    if( !m_dispOn ) return;
+
+    bool scanInv = m_rotate ? !m_scanInv : m_scanInv;
+
+    for( int row=0; row<8; row++ ){
+        for( int col=0; col<128; col++ )
+        {
+            uint8_t abyte = m_aDispRam[col][row];
+            if( m_dispInv ) abyte = ~abyte;      // Display Inverted
+
+            int x = col;
+            if( scanInv ) x = 127-x;
+            if( x >= m_width ) continue;
+
+            for( int bit=0; bit<8; bit++ )
+            {
+                int y = row*8+bit;
+                if( (abyte & 1) && y < m_height && y <= m_mr )
+                {
+                    if( scanInv ) y = 63-y;
+                    if( y < m_height ) ((QRgb*)m_image.scanLine( y ))[x] = foreground;
+                }
+                abyte >>= 1;
+}   }   }   }
+
 void Ssd1306::paint( QPainter* p, const QStyleOptionGraphicsItem*, QWidget* )
 {
     QPen pen( Qt::black, 1, Qt::SolidLine, Qt::RoundCap, Qt::RoundJoin );
@@ -438,39 +549,7 @@ void Ssd1306::paint( QPainter* p, const QStyleOptionGraphicsItem*, QWidget* )
     p->setBrush( QColor( 50, 70, 100 ) );
     p->drawRoundedRect( m_area, 2, 2 );
 
-    if( m_dispFull ) p->fillRect(-64,-m_height/2-10, m_width, m_height, m_foreground );
-    else{
-        QImage img( m_width*3, m_height*3, QImage::Format_RGB32 );
-        QPainter painter;
-        painter.begin( &img );
-        painter.fillRect( 0, 0, m_width*3, m_height*3, Qt::black );
-
-        bool scanInv = m_rotate ? !m_scanInv : m_scanInv;
+    p->drawImage( QRectF(-64,-m_height/2-10, m_width, m_height), m_image );
 
-        if( m_dispOn  ){
-            for( int row=0; row<8; row++ ){
-                for( int col=0; col<128; col++ )
-                {
-                    uint8_t abyte = m_aDispRam[col][row];
-                    if( m_dispInv ) abyte = ~abyte;      // Display Inverted
-
-                    int x = col*3;
-                    if( scanInv ) x = 127*3-x;
-
-                    for( int bit=0; bit<8; bit++ )
-                    {
-                        if( abyte & 1 ){
-                            int y = row*8+bit;
-                            if( y >= m_height ) continue;
-                            if( y > m_mr ) continue;
-                            if( scanInv ) y = 63-y;
-                            painter.fillRect( x, y*3, 3, 3, m_foreground );
-                       }
-                       abyte >>= 1;
-        }   }   }   }
-
-        painter.end();
-        p->drawImage(QRectF(-64,-m_height/2-10, m_width, m_height), img );
-    }
     Component::paintSelected( p );
 }
@@ -6,6 +6,8 @@
 #ifndef SSD1306_H
 #define SSD1306_H
 
+#include <QImage>
+
 #include "twimodule.h"
 #include "component.h"
 
@@ -40,12 +42,15 @@ class Ssd1306 : public Component, public TwiModule
         void setHeight( int h );
 
         bool imgRotated() { return m_rotate; }
-        void setImgRotated( bool r ) { m_rotate = r; }
+        void setImgRotated( bool r ) { m_rotate = r; setDirty(); }
 
         virtual void initialize() override;
         virtual void stamp() override;
         virtual void updateStep() override;
 
+        virtual bool saveState( QDataStream& s ) override;
+        virtual bool loadState( QDataStream& s, bool check ) override;
+
         virtual void startWrite() override;
         virtual void readByte() override;
         
@@ -58,11 +63,14 @@ class Ssd1306 : public Component, public TwiModule
         void reset();
         void clearDDRAM();
         void updateSize();
+        void updateImage();
 
         dispColor m_dColor;
 
         unsigned char m_aDispRam[128][8]; //128x64 DDRAM
 
+        QImage m_image;  // Rendered at updateStep only if DDRAM or state changed
+
         int m_cdr;       // Clock Divide Ratio
         int m_mr;        // Multiplex Ratio
         int m_fosc;      // Oscillator Frequency
@@ -43,6 +43,8 @@ class LedMatrix : public Component, public eElement
         void  setRes( double resist );
 
         virtual void stamp() override;
+        virtual bool saveState( QDataStream& ) override { return true; }
+        virtual bool loadState( QDataStream&, bool ) override { return true; }
         virtual void remove() override;
 
         virtual void setHidden( bool hid, bool hidArea=false, bool hidLabel=false ) override;
@@ -23,6 +23,8 @@ class LedRgb : public Component, public eElement
 
         virtual void stamp() override;
         virtual void updateStep() override;
+        virtual bool saveState( QDataStream& ) override { return true; }
+        virtual bool loadState( QDataStream&, bool ) override { return true; }
         
         double threshold_R() { return m_led[0]->threshold(); }
         void   setThreshold_R( double threshold );
@@ -4,6 +4,7 @@
  ***( see copyright.txt file at root folder )*******************************/
 
 #include <QPainter>
+#include <QDataStream>
 
 #include "max72xx_matrix.h"
 #include "itemlibrary.h"
@@ -79,6 +80,8 @@ Max72xx_matrix::Max72xx_matrix( QString type, QString id )
     eClockedDevice::setClockPin( m_pinSck );
 
     Simulator::self()->addToUpdateList( this );
+    setViewItem( this );
+    setDirtyDriven( true );
 
     setLabelPos(-32, -58, 0);
     setShowId( true );
@@ -108,6 +111,7 @@ void Max72xx_matrix::initialize()
         m_intensity[i] = 0;
     }
     m_decodemode = 0;
+    setDirty();
     m_scanlimit = 0;
     m_shutdown = true;
     m_test = false;
@@ -119,6 +123,48 @@ void Max72xx_matrix::initialize()
     updateStep();
 }
 
+bool Max72xx_matrix::saveState( QDataStream& s )
+{
+    LogicComponent::saveState( s );
+    for( int i=0; i<16; i++)
+    {
+        for( int j=0; j<8; j++ ) s << m_ram[i][j];
+        s << m_intensity[i];
+    }
+    s << m_decodemode << m_scanlimit << m_shutdown << m_test;
+    s << m_rxReg << m_inBit << m_inDisplay;
+    return true;
+}
+
+bool Max72xx_matrix::loadState( QDataStream& s, bool check )
+{
+    if( !LogicComponent::loadState( s, check ) ) return false;
+
+    int ram[16][8], intensity[16];
+    for( int i=0; i<16; i++)
+    {
+        for( int j=0; j<8; j++ ) s >> ram[i][j];
+        s >> intensity[i];
+    }
+    int decodemode, scanlimit, rxReg, inBit, inDisplay;
+    bool shutdown, test;
+    s >> decodemode >> scanlimit >> shutdown >> test;
+    s >> rxReg >> inBit >> inDisplay;
+    if( check || s.status() != QDataStream::Ok ) return s.status() == QDataStream::Ok;
+
+    memcpy( m_ram, ram, sizeof(m_ram) );
+    memcpy( m_intensity, intensity, sizeof(m_intensity) );
+    m_decodemode = decodemode;
+    m_scanlimit  = scanlimit;
+    m_shutdown   = shutdown;
+    m_test       = test;
+    m_rxReg      = rxReg;
+    m_inBit      = inBit;
+    m_inDisplay  = inDisplay;
+    setDirty();
+    return true;
+}
+
 void Max72xx_matrix::voltChanged()
 {
     updateClock();
@@ -150,6 +196,7 @@ void Max72xx_matrix::updateStep() { update(); }
 void Max72xx_matrix::proccessCommand()
 {
     if ( m_inDisplay >= 16 ) return;
+    setDirty();
 
     int addr = (m_rxReg>>8) & 0x0F;
     switch( addr )
@@ -28,6 +28,8 @@ class Max72xx_matrix : public LogicComponent
         void setNumDisplays( int dispNumber );
 
         virtual void stamp() override;
+        virtual bool saveState( QDataStream& s ) override;
+        virtual bool loadState( QDataStream& s, bool check ) override;
         virtual void initialize() override;
         virtual void voltChanged() override;
         virtual void updateStep() override;
@@ -43,6 +43,8 @@ class SevenSegment : public Component, public eElement
         void   setResistance( double res );
 
         virtual void stamp() override;
+        virtual bool saveState( QDataStream& ) override { return true; }
+        virtual bool loadState( QDataStream&, bool ) override { return true; }
 
         virtual QStringList getEnumUids( QString ) override;
         virtual QStringList getEnumNames( QString ) override;
@@ -56,6 +56,8 @@ WS2812::WS2812( QString type, QString id )
     updateLeds();
 
     Simulator::self()->addToUpdateList( this );
+    setViewItem( this );
+    setDirtyDriven( true );
 
     addPropGroup( { tr("Main"), {
         new IntProp<WS2812>("Rows", tr("Rows"),""
@@ -89,6 +91,7 @@ void WS2812::updateStep() { update(); }
 void WS2812::initialize()
 {
     for( int i=0; i<m_leds; i++ ) m_led[i] = QColor( 0, 0, 0 );
+    setDirty();
     m_lastTime = 0;
     m_data = 0;
     m_word = 0;
@@ -169,6 +172,7 @@ void WS2812::saveBit( bool bit )
         if( ++m_byte > 2 )
         {
             m_led[ m_word ] = QColor( m_rgb[1], m_rgb[0], m_rgb[2] );
+            setDirty();
             m_byte = 0;
             m_word++;
 }   }   }
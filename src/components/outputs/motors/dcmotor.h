@@ -23,6 +23,7 @@ class DcMotor : public LinkerComponent, public eResistor
 
         virtual void initialize() override;
         virtual void stamp() override;
+        virtual bool saveState( QDataStream& ) override { return false; } // State not supported yet
         virtual void voltChanged() override;
         virtual void updateStep() override;
 
@@ -29,6 +29,7 @@ class Servo : public LogicComponent
         void setMaxPulse( double w );
 
         virtual void stamp() override;
+        virtual bool saveState( QDataStream& ) override { return false; } // State not supported yet
         virtual void updateStep() override;
         virtual void voltChanged() override;
 
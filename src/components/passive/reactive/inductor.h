@@ -30,6 +30,7 @@ class Inductor : public Reactive
     protected:
         virtual double updtRes()  override { return m_inductance/m_tStep; }
         virtual double updtCurr() override { return m_curSource - m_volt*m_admit; }
+        virtual double dcAdmit()  override { return 1e6; } // Shorted
 
         double m_inductance;
 };
@@ -23,6 +23,8 @@ class Potentiometer : public Dialed, public eElement
 
         virtual void initialize() override;
         virtual void updateStep() override;
+        virtual bool saveState( QDataStream& ) override { return true; }
+        virtual bool loadState( QDataStream&, bool ) override { return true; }
 
         double getVal();
         void setVal( double val );
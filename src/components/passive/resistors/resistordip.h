@@ -26,6 +26,8 @@ class ResistorDip : public Component, public eElement
 
         virtual void stamp() override;
         virtual void updateStep() override;
+        virtual bool saveState( QDataStream& ) override { return true; }
+        virtual bool loadState( QDataStream&, bool ) override { return true; }
 
         int size() { return m_size; }
         void setSize( int size );
@@ -3,6 +3,8 @@
  *                                                                         *
  ***( see copyright.txt file at root folder )*******************************/
 
+#include <QDataStream>
+
 #include "clock-base.h"
 #include "iopin.h"
 #include "simulator.h"
@@ -60,6 +62,30 @@ void ClockBase::updateStep()
     }
 }
 
+bool ClockBase::saveState( QDataStream& s )
+{
+    s << m_state << m_isRunning << (quint64)m_lastTime << m_remainder;
+    return true;
+}
+
+bool ClockBase::loadState( QDataStream& s, bool check )
+{
+    bool state, running;
+    quint64 lastTime;
+    double remainder;
+    s >> state >> running >> lastTime >> remainder;
+    if( check || s.status() != QDataStream::Ok ) return s.status() == QDataStream::Ok;
+
+    m_state     = state;
+    m_lastTime  = lastTime;
+    m_remainder = remainder;
+    m_isRunning = running;
+    m_button->setChecked( running );
+    m_changed = false; // Don't restart: next event restored by Simulator
+    update();
+    return true;
+}
+
 void ClockBase::setAlwaysOn( bool on )
 {
     m_alwaysOn = on;
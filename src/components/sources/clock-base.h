@@ -18,6 +18,8 @@ class ClockBase : public FixedVolt
 
         virtual void stamp() override;
         virtual void updateStep() override;
+        virtual bool saveState( QDataStream& s ) override;
+        virtual bool loadState( QDataStream& s, bool check ) override;
 
         bool alwaysOn() { return m_alwaysOn; }
         void setAlwaysOn( bool on );
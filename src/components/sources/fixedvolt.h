@@ -27,6 +27,8 @@ class FixedVolt : public Component, public eElement
 
         virtual void stamp() override;
         virtual void updateStep() override;
+        virtual bool saveState( QDataStream& ) override { return true; }
+        virtual bool loadState( QDataStream&, bool ) override { return true; }
 
         bool out();
         virtual void setOut( bool out );
@@ -29,6 +29,8 @@ class VarSource : public Component, public eElement
         void setRunning( bool r );
 
         virtual void initialize() override;
+        virtual bool saveState( QDataStream& ) override { return true; }
+        virtual bool loadState( QDataStream&, bool ) override { return true; }
 
         virtual void paint( QPainter* p, const QStyleOptionGraphicsItem* option, QWidget* widget ) override;
 
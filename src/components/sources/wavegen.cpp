@@ -50,6 +50,10 @@ WaveGen::WaveGen( QString type, QString id )
     m_lastVout = 0;
     m_waveType = Sine;
     m_wavePixmap = NULL;
+    m_wavData = NULL;
+    m_numSamples = 0;
+    m_channel = 0;
+    m_chanOffset = 0;
 
     m_pin.resize(2);
     m_pin[1] = m_gndpin = new IoPin( 0, QPoint(16,4), id+"-gndnod", 0, this, source );
@@ -97,6 +101,9 @@ WaveGen::WaveGen( QString type, QString id )
         new StrProp <WaveGen>("File", tr("File"), ""
                              , this, &WaveGen::fileName, &WaveGen::setFile ),
 
+        new IntProp <WaveGen>("Channel", tr("Channel"), ""
+                             , this, &WaveGen::channel, &WaveGen::setChannel ),
+
         new BoolProp<WaveGen>("Always_On", tr("Always On"), ""
                              , this, &WaveGen::alwaysOn, &WaveGen::setAlwaysOn )
     },0} );
@@ -119,6 +126,7 @@ WaveGen::WaveGen( QString type, QString id )
 }
 WaveGen::~WaveGen()
 {
+    closeWav();
     delete m_wavePixmap;
 }
 
@@ -230,10 +238,32 @@ void WaveGen::genRandom()
 
 void WaveGen::genWav()
 {
-    m_vOut = m_data.at( m_index );
     m_nextStep = m_qSteps;
+    if( !m_numSamples ) return;
+    if( m_index >= m_numSamples ) m_index = 0; // File may have changed
+
+    m_vOut = wavSample( m_index );
     m_index++;
-    if( m_index >= m_data.size() ) m_index = 0;
+}
+
+inline double WaveGen::wavSample( uint64_t index ) // Decode one sample of selected channel
+{
+    const uchar* sample = m_wavData + index*m_blockSize + m_chanOffset;
+
+    if( m_audioFormat == 1 ) // PCM
+    {
+        int16_t data = 0;
+        memcpy( &data, sample, m_bytes );
+        return normalize( data );
+    }
+    if( m_bytes == 4 ){      // IEEE_FLOAT 32 bits
+        float data = 0;
+        memcpy( &data, sample, 4 );
+        return normalize( data );
+    }
+    double data = 0;         // IEEE_FLOAT 64 bits
+    memcpy( &data, sample, 8 );
+    return normalize( data );
 }
 
 void WaveGen::setDuty( double duty )
@@ -330,6 +360,7 @@ void WaveGen::updtProperties()
     default: break;
     }
     m_propDialog->showProp("File", showFile );
+    m_propDialog->showProp("Channel", showFile );
     m_propDialog->showProp("Duty", showDuty );
     m_propDialog->showProp("Steps", showSteps );
 
@@ -387,18 +418,22 @@ void WaveGen::setFile( QString fileName )
         qDebug() << "WaveGen::setFile Error: file doesn't exist:\n"<<fileNameAbs<<"\n";
         return;
     }
-    QFile WAVFile( fileNameAbs );
-    if( !WAVFile.open( QIODevice::ReadWrite ) )
+    Simulator::self()->pauseSim();   // Simulation thread may be reading mapped samples
+    Simulator::self()->waitCircuit();
+    closeWav();
+    m_index = 0;
+    m_wavFile.setFileName( fileNameAbs );
+    if( !m_wavFile.open( QIODevice::ReadOnly ) )
     {
        qDebug() << "WaveGen::setFile Could not open:\n" << fileNameAbs<<"\n";
+       Simulator::self()->resumeSim();
        return;
     }
-    Simulator::self()->pauseSim();
 
-    QDataStream dataStream( &WAVFile );
+    QDataStream dataStream( &m_wavFile );
     dataStream.setByteOrder( QDataStream::LittleEndian );
     char strm[4];
-    int32_t dataSize = 0;
+    uint32_t dataSize = 0;
     while( true )                   // Read Header
     {
         dataStream.readRawData( strm, 4 );    // 4 File Format = "RIFF"
@@ -408,95 +443,106 @@ void WaveGen::setFile( QString fileName )
         if( QString( QByteArray(strm,4) ) != "WAVE" ) break;
         dataStream.readRawData( strm, 4 );    // 4 Format section header= "fmt "
         if( QString( QByteArray(strm,4) ) != "fmt " ) break;
-        dataStream.readRawData( strm, 4 );    // 4 Size of Format section
+        uint32_t fmtSize = 0;
+        dataStream >> fmtSize;                // 4 Size of Format section
         dataStream >> m_audioFormat;          // 2 Format type
         dataStream >> m_numChannels;          // 2 Number of channels
         dataStream >> m_sampleRate;           // 4 Sample rate
         dataStream.readRawData( strm, 4 );    // 4 Byte rate: (Sample Rate * BitsPerSample * Channels) / 8.
         dataStream >> m_blockSize;            // 2 Block size (bytes): (BitsPerSample * Channels) / 8.
         dataStream >> m_bitsPerSample;        // 2 Bits per sample
+        if( fmtSize > 16 ) dataStream.skipRawData( fmtSize-16 ); // Format extension
         dataStream.readRawData( strm, 4 );    // 4 Data section header = "data"
         QString section = QString( QByteArray(strm,4) );
         while( section  != "data" )
         {
+            if( dataStream.atEnd() ) break;
             qDebug() << "WaveGen::setFile Warning: Section not supported: " << section;
-            uint32_t size = 0;   // 4 Size of Format section
+            uint32_t size = 0;   // 4 Size of section
             dataStream >> size;
-            uint8_t data = 0;
-            for( uint i=0; i<size; i++ ) dataStream >> data;
+            dataStream.skipRawData( size );
             dataStream.readRawData( strm, 4 );
             section = QString( QByteArray(strm,4) );
         }
-        dataStream >> dataSize; // Size of Data section
+        if( section == "data" ) dataStream >> dataSize; // Size of Data section
         break;
     }
-    if( dataSize )                  // Read samples
+    if( dataSize && m_numChannels && m_blockSize )
     {
-        int bytes = m_blockSize/m_numChannels;
+        m_bytes = m_blockSize/m_numChannels;
 
+        bool ok = false;
         if( m_audioFormat == 1 ) // PCM
         {
             qDebug() << "WaveGen::setFile Audio format: PCM" << m_bitsPerSample << "bits"<<m_numChannels<<"Channels";
-            if( bytes == 1 ){
+            if( m_bytes == 1 ){
                 m_minValue = 0;
                 m_maxValue = 255;
-            }else if( bytes == 2 ){
+                ok = true;
+            }else if( m_bytes == 2 ){
                 m_minValue = -32768;
                 m_maxValue = 32767;
+                ok = true;
             }
-            else { qDebug() << "WaveGen::setFile Error: PCM format"<<bytes<<"bytes"; WAVFile.close(); return;}
+            else qDebug() << "WaveGen::setFile Error: PCM format"<<m_bytes<<"bytes";
         }
         else if( m_audioFormat == 3 ) // IEEE_FLOAT
         {
-            if( bytes == 4 || bytes == 8 ){
+            if( m_bytes == 4 || m_bytes == 8 ){
                 qDebug() << "WaveGen::setFile Audio format: IEEE_FLOAT" << m_bitsPerSample << "bits"<<m_numChannels<<"Channels";
                 m_minValue = -1;
                 m_maxValue = 1;
+                ok = true;
             }
-            else { qDebug() << "WaveGen::setFile Error: IEEE_FLOAT format"<<bytes<<"bytes"; WAVFile.close(); return;}
+            else qDebug() << "WaveGen::setFile Error: IEEE_FLOAT format"<<m_bytes<<"bytes";
         }
-        else { qDebug() << "WaveGen::setFile Error: Audio format not supported:"; WAVFile.close(); return;}
+        else qDebug() << "WaveGen::setFile Error: Audio format not supported:";
 
-        char sample[bytes];
-        m_data.clear();
-        //m_data.resize( m_numChannels );
+        if( ok ){
+            qint64 offset = m_wavFile.pos();
+            qint64 size = qMin( (qint64)dataSize, m_wavFile.size()-offset );
+            m_numSamples = size/m_blockSize;
+            size = m_numSamples*m_blockSize;
 
-        for( int block=0; block < dataSize/m_blockSize; ++block )
-        {
-            for( int ch=0; ch < m_numChannels; ++ch )
+            m_wavData = m_wavFile.map( offset, size ); // Samples are read from file as needed
+            if( !m_wavData )                          // Can't map file: load samples
             {
-                dataStream.readRawData( sample, bytes );
-                if( ch != 0 ) continue;
-
-                if( m_audioFormat == 1 ) // PCM
-                {
-                    int16_t data = 0;
-                    memcpy( &data, sample, bytes );
-                    m_data.emplace_back( normalize( data ) );
-                }
-                else if( m_audioFormat == 3 ) // IEEE_FLOAT
-                {
-                    if( bytes == 4 ){         // 32 bits
-                        float data = 0;
-                        memcpy( &data, sample, bytes );
-                        m_data.emplace_back( normalize( data ) );
-                    }
-                    else if( bytes == 8 ){    // 64 bits
-                        double data = 0;
-                        memcpy( &data, sample, bytes );
-                        m_data.emplace_back( normalize( data ) );
-                    }
-                }
+                m_wavBuffer = m_wavFile.read( size );
+                m_wavData = (uchar*)m_wavBuffer.data();
+                m_numSamples = m_wavBuffer.size()/m_blockSize;
             }
+            setChannel( m_channel );
+            setFreq( m_sampleRate );
+            setSteps( 1 );
+            qDebug() << "WaveGen::setFile Success Loaded wav file:\n" << fileNameAbs;
         }
-        setFreq( m_sampleRate );
-        setSteps( 1 );
-        qDebug() << "WaveGen::setFile Success Loaded wav file:\n" << fileNameAbs;
+        else closeWav();
+    }
+    else{
+        qDebug() << "WaveGen::setFile Error reading wav file:\n" << fileNameAbs;
+        closeWav();
     }
-    else qDebug() << "WaveGen::setFile Error reading wav file:\n" << fileNameAbs;
+    Simulator::self()->resumeSim();
     qDebug() << "\n";
+}
+
+void WaveGen::closeWav()
+{
+    if( m_wavData && m_wavBuffer.isEmpty() ) m_wavFile.unmap( m_wavData );
+    m_wavFile.close();
+    m_wavBuffer.clear();
+    m_wavData = NULL;
+    m_numSamples = 0;
+}
+
+void WaveGen::setChannel( int ch )
+{
+    if( ch < 0 ) ch = 0;
+    m_channel = ch;
+    if( !m_numSamples ) return;
 
-    WAVFile.close();
+    if( ch >= m_numChannels ) ch = m_numChannels-1;
+    m_chanOffset = ch*m_bytes;
 }
 
 inline double WaveGen::normalize( double data )
@@ -6,6 +6,8 @@
 #ifndef WAVEGEN_H
 #define WAVEGEN_H
 
+#include <QFile>
+
 #include "clock-base.h"
 
 class LibraryItem;
@@ -31,6 +33,7 @@ class WaveGen : public ClockBase
         virtual bool setPropStr( QString prop, QString val ) override;
 
         virtual void stamp() override;
+        virtual bool saveState( QDataStream& ) override { return false; } // State not supported yet
         virtual void runEvent() override;
 
         double duty() { return m_duty; }
@@ -54,6 +57,9 @@ class WaveGen : public ClockBase
         QString fileName() { return m_fileName; }
         void setFile( QString fileName );
 
+        int channel() { return m_channel; }
+        void setChannel( int ch );
+
         bool bipolar() { return m_bipolar; }
         void setBipolar( bool b );
 
@@ -78,6 +84,8 @@ class WaveGen : public ClockBase
         void genSquare();
         void genRandom();
         void genWav();
+        void closeWav();
+        double wavSample( uint64_t index );
 
         void updtProperties();
 
@@ -100,19 +108,26 @@ class WaveGen : public ClockBase
         uint64_t m_qSteps;
         uint64_t m_nextStep;
 
-        uint m_index;
+        uint64_t m_index;
         uint16_t m_audioFormat;
         uint16_t m_numChannels;
         uint32_t m_sampleRate;
         uint16_t m_blockSize;
         uint16_t m_bitsPerSample;
+        uint16_t m_bytes;       // Bytes per sample
+        uint16_t m_chanOffset;  // Selected channel offset in block
+        uint64_t m_numSamples;
+        int      m_channel;
 
         double m_maxValue;
         double m_minValue;
         double m_mult;
-        std::vector<double> m_data;
         QString m_fileName;
 
+        uchar*     m_wavData;   // Samples mapped from file (or in m_wavBuffer)
+        QByteArray m_wavBuffer; // Used if file can't be mapped
+        QFile      m_wavFile;
+
         IoPin* m_gndpin;
 
         QStringList m_waves;
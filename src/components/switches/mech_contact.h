@@ -27,6 +27,8 @@ class MechContact : public Component, public eElement
         virtual void stamp() override;
         virtual void remove() override;
         virtual void updateStep() override { if( m_changed ) { m_changed = false; update(); } }
+        virtual bool saveState( QDataStream& ) override { return true; }
+        virtual bool loadState( QDataStream&, bool ) override { return true; }
 
         void  SetupSwitches( int poles, int throws );
         void  SetupButton();
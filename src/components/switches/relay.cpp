@@ -3,6 +3,7 @@
  *                                                                         *
  ***( see copyright.txt file at root folder )*******************************/
 
+#include <QDataStream>
 #include <QPainter>
 #include <math.h>
 
@@ -107,6 +108,23 @@ void Relay::stamp()
     m_inductor->getPin( 1 )->changeCallBack( this );
 }
 
+bool Relay::saveState( QDataStream& s )
+{
+    s << m_relayOn;
+    return true;
+}
+
+bool Relay::loadState( QDataStream& s, bool check )
+{
+    bool relayOn;
+    s >> relayOn;
+    if( check || s.status() != QDataStream::Ok ) return s.status() == QDataStream::Ok;
+
+    m_relayOn = relayOn;
+    if( m_relayOn != m_closed ) setSwitch( m_relayOn );
+    return true;
+}
+
 void Relay::voltChanged()
 {
     double indCurr = fabs( m_inductor->indCurrent() );
@@ -30,6 +30,8 @@ class Relay : public MechContact
         virtual void initialize() override;
         virtual void stamp() override;
         virtual void voltChanged() override;
+        virtual bool saveState( QDataStream& s ) override;
+        virtual bool loadState( QDataStream& s, bool check ) override;
 
         virtual void paint( QPainter* p, const QStyleOptionGraphicsItem* o, QWidget* w ) override;
 
@@ -36,6 +36,8 @@ class SwitchDip : public Component, public eElement
 
         virtual void stamp() override;
         virtual void updateStep() override;
+        virtual bool saveState( QDataStream& ) override { return true; }
+        virtual bool loadState( QDataStream&, bool ) override { return true; }
         virtual void remove() override;
 
         void createSwitches( int c );
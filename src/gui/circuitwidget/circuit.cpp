@@ -64,6 +64,8 @@ Circuit::Circuit( qreal x, qreal y, qreal width, qreal height, CircuitView*  par
     m_seqNumber = 0;
     m_conNumber = 0;
     m_maxUndoSteps = 100;
+    m_maxUndoBytes = 32*1024*1024;
+    m_undoBytes = 0;
     m_undoIndex = -1;
 
     m_backupPath = MainWindow::self()->getConfigPath("backup.sim1");
@@ -661,6 +663,7 @@ void Circuit::removeItems()                     // Remove Selected items
 void Circuit::removeComp( Component* comp )
 {
     //if( comp->parentItem() ) return; // subcircuit
+    saveState( comp );
     m_compRemoved = false;
     comp->remove();
     if( !m_compRemoved ) return;
@@ -675,6 +678,7 @@ void Circuit::removeNode( Node* node )
 {
     if( !m_nodeList.contains(node) ) return;
     if( m_deleting ) return;
+    saveState( node );
     m_nodeList.removeOne( node );
     m_compMap.remove( node->getUid() );
     removeItem( node );
@@ -684,6 +688,7 @@ void Circuit::removeNode( Node* node )
 void Circuit::removeConnector( Connector* conn )
 {
     if( !m_connList.contains(conn) ) return;
+    saveState( conn );
     conn->remove();
     m_connList.removeOne( conn );
     m_compMap.remove( conn->getUid() );
@@ -734,21 +739,24 @@ void Circuit::saveChanges()
     if( m_conStarted || m_circChange.size() == 0 ) return;
     setChanged();
 
-    while( m_undoStack.size() > (m_undoIndex+1) ) m_undoStack.removeLast();
+    while( m_undoStack.size() > (m_undoIndex+1) ) removeUndoStep( m_undoStack.size()-1 );
 
     m_undoStack.append( m_circChange );
-    if( m_undoStack.size() > m_maxUndoSteps )
+    m_undoBytes += stepBytes( m_circChange );
+    m_undoIndex++;
+
+    while( m_undoStack.size() > 1
+       && ( m_undoStack.size() > m_maxUndoSteps || m_undoBytes > m_maxUndoBytes ) )
     {
-        m_undoStack.takeFirst();
+        removeUndoStep( 0 );
         m_undoIndex--;
     }
-    m_undoIndex++;
-
     clearCircChanges();
+    m_compStrMap.clear();
     m_cicuitBatch = 0;  // Ends all CicuitChanges
     deleteRemoved();    // Delete Removed Components;
 
-    /// qDebug() << "Circuit::saveChanges ---------------------------"<<m_undoIndex<<m_undoStack.size()<<endl;
+    /// qDebug() << "Circuit::saveChanges ---------------------------"<<m_undoIndex<<m_undoStack.size()<<m_undoBytes<<endl;
 }
 
 void Circuit::deleteRemoved()
@@ -760,10 +768,42 @@ void Circuit::deleteRemoved()
 void Circuit::removeLastUndo()
 {
     if( m_undoStack.isEmpty() ) return;
-    m_undoStack.takeLast();
+    removeUndoStep( m_undoStack.size()-1 );
     m_undoIndex--;
 }
 
+void Circuit::removeUndoStep( int index )
+{
+    m_undoBytes -= stepBytes( m_undoStack[index] );
+    m_undoStack.removeAt( index );
+}
+
+int Circuit::stepBytes( circChange& step ) // Approximate memory used by an undo step
+{
+    int bytes = 0;
+    for( compChange& cChange : step.compChanges )
+        bytes += 2*( cChange.component.size()+cChange.property.size() )
+                +cChange.undoValue.size()+cChange.redoValue.size();
+    return bytes;
+}
+
+QByteArray Circuit::packStr( QString str ) // Store Items compressed, short values as plain utf8
+{
+    if( str.isEmpty() ) return QByteArray();
+
+    QByteArray data = str.toUtf8();
+    if( data.size() < 128 ) return data.prepend('\0');
+    return qCompress( data ).prepend('\1');
+}
+
+QString Circuit::unpackStr( QByteArray data )
+{
+    if( data.isEmpty() ) return "";
+
+    if( data.at(0) == '\1' ) return QString::fromUtf8( qUncompress( data.mid( 1 ) ) );
+    return QString::fromUtf8( data.constData()+1, data.size()-1 );
+}
+
 void Circuit::beginCircuitBatch() // Don't create/remove
 {
     /// qDebug() << "Circuit::beginCircuitBatch";
@@ -787,7 +827,7 @@ void Circuit::cancelUndoStep()
     {
         endCircuitBatch();
         undo();
-        m_undoStack.takeLast();
+        removeUndoStep( m_undoStack.size()-1 );
     }
     else m_cicuitBatch = 0;
     /// qDebug() << "Circuit::cancelUndoStep--------------------------------"<<endl;
@@ -799,13 +839,21 @@ void Circuit::beginUndoStep() // Save current state
 
     m_oldConns = m_connList;
     m_oldComps = m_compList;
-    m_oldNodes = m_nodeList;
-    m_compStrMap.clear();      /// FIXME: optimize this, we are saving the whole circuit every time
+    m_oldNodes = m_nodeList;   // Implicitly shared: items are serialized only if removed (saveState)
+    m_compStrMap.clear();
+}
 
-    //save all comps
-    for( Connector* conn : m_oldConns ) m_compStrMap.insert( conn, conn->toString() );
-    for( Node*      node : m_oldNodes ) m_compStrMap.insert( node, node->toString() );
-    for( Component* comp : m_oldComps ) m_compStrMap.insert( comp, comp->toString() );
+void Circuit::saveState( CompBase* item ) // Called before an item is modified to be removed
+{
+    if( !m_cicuitBatch || m_loading || m_deleting || m_undo || m_redo ) return;
+    if( m_compStrMap.contains( item ) ) return;
+    m_compStrMap.insert( item, item->toString() );
+}
+
+QString Circuit::removedState( CompBase* item )
+{
+    if( m_compStrMap.contains( item ) ) return m_compStrMap.value( item );
+    return item->toString(); // Removed without Circuit::removeXXX(), still alive
 }
 
 void Circuit::endUndoStep()   //
@@ -822,9 +870,9 @@ void Circuit::calcCircuitChanges()   // Calculates created/removed
     QList<Node*>      removedNodes = substract( m_oldNodes, m_nodeList );
     QList<Component*> removedComps = substract( m_oldComps, m_compList );
 
-    for( Connector* conn : removedConns ) addCompChange( conn->getUid(), COMP_STATE_NEW, m_compStrMap.value(conn) );
-    for( Node*      node : removedNodes ) addCompChange( node->getUid(), COMP_STATE_NEW, m_compStrMap.value(node) );
-    for( Component* comp : removedComps ) addCompChange( comp->getUid(), COMP_STATE_NEW, m_compStrMap.value(comp) );
+    for( Connector* conn : removedConns ) addCompChange( conn->getUid(), COMP_STATE_NEW, removedState( conn ) );
+    for( Node*      node : removedNodes ) addCompChange( node->getUid(), COMP_STATE_NEW, removedState( node ) );
+    for( Component* comp : removedComps ) addCompChange( comp->getUid(), COMP_STATE_NEW, removedState( comp ) );
 
     /// qDebug() << "Circuit::calcCicuitChanges Created:";
     // Items Created
@@ -847,7 +895,7 @@ void Circuit::saveCompChange( QString component, QString property, QString undoV
 void Circuit::addCompChange( QString component, QString property, QString undoVal )
 {
     if( m_loading || m_deleting ) return;                      /// qDebug() << "Circuit::addCompChange      " << component << property;// << value;
-    compChange cChange{ component, property, undoVal, "" };
+    compChange cChange{ component, property, packStr( undoVal ), QByteArray() };
     m_circChange.compChanges.append( cChange );
 }
 
@@ -857,6 +905,7 @@ void Circuit::restoreState()
     m_busy = true;
 
     circChange& step = m_undoStack[ m_undoIndex ];
+    m_undoBytes -= stepBytes( step ); // Redo values are added at first Undo
 
     int iStep, i;
     if( m_undo ) { iStep = -1; i = step.compChanges.size()-1; }
@@ -867,7 +916,7 @@ void Circuit::restoreState()
         compChange* cChange = &step.compChanges[i];
         i += iStep;
         QString propName   = cChange->property;
-        QString propVal    = m_undo ? cChange->undoValue : cChange->redoValue;
+        QString propVal    = unpackStr( m_undo ? cChange->undoValue : cChange->redoValue );
         CompBase* comp     = m_compMap.value( cChange->component );             /// qDebug() << "Circuit::restoreState"<< cChange->component << propName << comp;
 
         if( propName == COMP_STATE_NEW )  // Create/Remove Item
@@ -875,7 +924,7 @@ void Circuit::restoreState()
             if( propVal.isEmpty() )       // Remove item
             {
                 if( !comp ) continue;
-                if( m_undo && cChange->redoValue.isEmpty() ) cChange->redoValue = comp->toString();
+                if( m_undo && cChange->redoValue.isEmpty() ) cChange->redoValue = packStr( comp->toString() );
 
                 if     ( comp->itemType() == "Connector" ) removeConnector( (Connector*)comp );
                 else if( comp->itemType() == "Node"      ) removeNode( (Node*)comp );
@@ -885,10 +934,11 @@ void Circuit::restoreState()
         }
         else if( comp )                   // Modify Property
         {
-            if( m_undo && cChange->redoValue.isEmpty() ) cChange->redoValue = comp->getPropStr( propName );
+            if( m_undo && cChange->redoValue.isEmpty() ) cChange->redoValue = packStr( comp->getPropStr( propName ) );
             comp->setPropStr( propName, propVal );
         }
     }
+    m_undoBytes += stepBytes( step );
     m_busy = false;
     deleteRemoved();                      // Delete Removed Components;
     for( Connector* con : m_connList ) {
@@ -61,6 +61,7 @@ class Circuit : public QGraphicsScene
         void cancelUndoStep();     // Revert changes done
         void beginUndoStep();      // Record current state
         void endUndoStep();        // Does create/remove
+        void saveState( CompBase* item ); // Store item before it is removed
         bool undoRedo() { return m_undo || m_redo; }
         //------------------------------------------------
 
@@ -101,6 +102,7 @@ class Circuit : public QGraphicsScene
         void setBoard( SubPackage* b ) { m_board = b; }
 
         bool pasting() { return m_pasting; }
+        bool loading() { return m_loading; }
         bool isBusy()  { return m_busy || m_pasting | m_deleting; }
         bool isSubc()  { return m_createSubc; }
 
@@ -214,11 +216,11 @@ class Circuit : public QGraphicsScene
 
         //--- Undo/Redo ----------------------------------
 
-        struct compChange{      // Component Change to be performed by Undo/Redo to complete a Circuit change
-            QString component;  // Component name
-            QString property;   // Property name
-            QString undoValue;  // Property value for Undo step
-            QString redoValue;  // Property value for Redo step
+        struct compChange{         // Component Change to be performed by Undo/Redo to complete a Circuit change
+            QString    component;  // Component name
+            QString    property;   // Property name
+            QByteArray undoValue;  // Property value for Undo step (packStr)
+            QByteArray redoValue;  // Property value for Redo step (packStr)
         };
         struct circChange{       // Circuit Change to be performed by Undo/Redo to restore circuit state
             QList<compChange> compChanges;
@@ -229,8 +231,16 @@ class Circuit : public QGraphicsScene
         inline void clearCircChanges() { m_circChange.clear(); }
         void deleteRemoved();
         void restoreState();
+        void removeUndoStep( int index );
+        int  stepBytes( circChange& step );
+        QString removedState( CompBase* item );
+
+        static QByteArray packStr( QString str );
+        static QString unpackStr( QByteArray data );
 
         int m_maxUndoSteps;
+        int m_maxUndoBytes;
+        int m_undoBytes;  // Memory used by m_undoStack
         int m_undoIndex;
 
         circChange m_circChange;
@@ -240,7 +250,7 @@ class Circuit : public QGraphicsScene
         QList<Connector*> m_oldConns;
         QList<Component*> m_oldComps;
         QList<Node*>      m_oldNodes;
-        QMap<CompBase*, QString> m_compStrMap;
+        QHash<CompBase*, QString> m_compStrMap; // Items removed in current step
 };
 
 #endif
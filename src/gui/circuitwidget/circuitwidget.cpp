@@ -9,6 +9,7 @@
 #include <QFileDialog>
 #include <QDesktopServices>
 #include <QSettings>
+#include <QProgressDialog>
 
 #include "circuitwidget.h"
 #include "editorwindow.h"
@@ -20,6 +21,7 @@
 #include "infowidget.h"
 #include "about.h"
 #include "utils.h"
+#include "paramsweep.h"
 
 CircuitWidget* CircuitWidget::m_pSelf = 0l;
 
@@ -154,6 +156,21 @@ void CircuitWidget::createActions()
     connect( pauseSimAct, &QAction::triggered,
              this, &CircuitWidget::pauseCirc, Qt::UniqueConnection );
 
+    saveStateAct = new QAction( QIcon(":/save.svg"),tr("Save Simulation State"), this);
+    saveStateAct->setStatusTip(tr("Save the state of running Simulation to disk"));
+    connect( saveStateAct, &QAction::triggered,
+                     this, &CircuitWidget::saveSimState, Qt::UniqueConnection );
+
+    loadStateAct = new QAction( QIcon(":/load.svg"),tr("Load Simulation State"), this);
+    loadStateAct->setStatusTip(tr("Continue running Simulation from a saved state"));
+    connect( loadStateAct, &QAction::triggered,
+                     this, &CircuitWidget::loadSimState, Qt::UniqueConnection );
+
+    sweepAct = new QAction( QIcon(":/reload.svg"),tr("Parameter Sweep..."), this);
+    sweepAct->setStatusTip(tr("Run the Circuit for each set of values in a sweep file"));
+    connect( sweepAct, &QAction::triggered,
+                 this, &CircuitWidget::runSweep, Qt::UniqueConnection );
+
     settAppAct = new QAction( QIcon(":/config.svg"),tr("Settings"), this);
     settAppAct->setStatusTip(tr("Settings"));
     connect( settAppAct, &QAction::triggered,
@@ -216,6 +233,17 @@ void CircuitWidget::createToolBars()
 
     m_circToolBar.addAction( powerCircAct );
     m_circToolBar.addAction( pauseSimAct );
+
+    m_stateMenu.addAction( saveStateAct );
+    m_stateMenu.addAction( loadStateAct );
+    m_stateMenu.addSeparator();
+    m_stateMenu.addAction( sweepAct );
+    QToolButton* stateButton = new QToolButton( this );
+    stateButton->setToolTip( tr("Simulation Tools") );
+    stateButton->setMenu( &m_stateMenu );
+    stateButton->setIcon( QIcon(":/reload.svg") );
+    stateButton->setPopupMode( QToolButton::InstantPopup );
+    m_circToolBar.addWidget( stateButton );
     m_circToolBar.addSeparator();//..........................
 
     spacer = new QWidget();
@@ -451,6 +479,70 @@ void CircuitWidget::pauseCirc()
     }
 }
 
+void CircuitWidget::saveSimState()
+{
+    if( !Simulator::self()->isRunning() )
+    { setMsg( " "+tr("Simulation not running")+" ", 1 ); return; }
+
+    bool running = !Simulator::self()->isPaused();
+    if( running ) pauseCirc(); // Save state at this point in time
+
+    QString path = Circuit::self()->getFilePath();
+    path = path.left( path.lastIndexOf(".") )+".sst";
+    QString fileName = QFileDialog::getSaveFileName( this, tr("Save Simulation State"), path,
+                                                     tr("Simulation State (*.sst);;All files (*.*)") );
+    if( !fileName.isEmpty() && !Simulator::self()->saveState( fileName ) )
+        QMessageBox::warning( this, "CircuitWidget::saveSimState", tr("Cannot write file %1").arg( fileName ) );
+
+    if( running ) pauseCirc(); // Resume
+}
+
+void CircuitWidget::loadSimState()
+{
+    if( !Simulator::self()->isRunning() ) powerCircOn(); // State is loaded on top of initialized Circuit
+
+    bool running = !Simulator::self()->isPaused();
+    if( running ) pauseCirc();
+
+    QString path = Circuit::self()->getFilePath();
+    QString fileName = QFileDialog::getOpenFileName( this, tr("Load Simulation State"), path,
+                                                     tr("Simulation State (*.sst);;All files (*.*)") );
+    if( !fileName.isEmpty() && !Simulator::self()->loadState( fileName ) )
+        QMessageBox::warning( this, "CircuitWidget::loadSimState", tr("Simulation State doesn't match this Circuit") );
+
+    if( running ) pauseCirc();
+}
+
+void CircuitWidget::runSweep()
+{
+    QString path = Circuit::self()->getFilePath();
+    QString fileName = QFileDialog::getOpenFileName( this, tr("Load Sweep File"), path,
+                                                     tr("Sweep files (*.swp);;All files (*.*)") );
+    if( fileName.isEmpty() ) return;
+
+    if( Simulator::self()->isRunning() ) powerCircOff();
+
+    ParamSweep sweep;
+    if( !sweep.loadFile( fileName ) )
+    {
+        QMessageBox::warning( this, "CircuitWidget::runSweep", tr("Error in sweep file %1").arg( fileName ) );
+        return;
+    }
+    QString csvFile = fileName.left( fileName.lastIndexOf(".") )+".csv";
+
+    QProgressDialog progress( tr("Running Parameter Sweep..."), tr("Cancel"), 0, sweep.variants(), this );
+    progress.setWindowModality( Qt::WindowModal );
+    progress.setMinimumDuration( 500 );
+
+    bool ok = sweep.run( csvFile, &progress );
+    bool canceled = progress.wasCanceled();
+    progress.setValue( sweep.variants() );
+
+    if( !ok ) QMessageBox::warning( this, "CircuitWidget::runSweep", tr("Cannot write file %1").arg( csvFile ) );
+    else if( canceled ) setMsg( " "+tr("Sweep canceled")+" ", 1 );
+    else setMsg( " "+tr("Sweep done: ")+QString::number( sweep.variants() )+tr(" runs")+" ", 0 );
+}
+
 void CircuitWidget::settApp()
 {
     if( !m_appPropW )
@@ -55,6 +55,9 @@ class CircuitWidget : public QWidget
         void saveCircAs();
         void powerCirc();
         void pauseCirc();
+        void saveSimState();
+        void loadSimState();
+        void runSweep();
         void settApp();
         void openInfo();
         void about();
@@ -94,6 +97,9 @@ class CircuitWidget : public QWidget
         QAction* zoomOneAct;
         QAction* powerCircAct;
         QAction* pauseSimAct;
+        QAction* saveStateAct;
+        QAction* loadStateAct;
+        QAction* sweepAct;
         QAction* settAppAct;
         QAction* infoAct;
         QAction* aboutAct;
@@ -101,6 +107,7 @@ class CircuitWidget : public QWidget
         
         QMenu m_fileMenu;
         QMenu m_infoMenu;
+        QMenu m_stateMenu;
         
         QString m_curCirc;
         QString m_lastCircDir;
@@ -350,6 +350,8 @@ void Connector::splitCon( int index, Pin* pin0, Pin* pin2 )
 {
     if( !m_endPin ) return;
 
+    Circuit::self()->saveState( this ); // Lines and Pins are moved before removing
+
     QString id = "Connector-"+Circuit::self()->newConnectorId();
     Connector* con0 = new Connector( "Connector", id, m_startPin );
     Circuit::self()->conList()->append( con0 );
@@ -3,6 +3,7 @@
  *                                                                         *
  ***( see copyright.txt file at root folder )*******************************/
 
+#include <QDataStream>
 #include <QtMath>
 
 #include "iopin.h"
@@ -115,6 +116,41 @@ void IoPin::runEvent()
     }
 }
 
+bool IoPin::saveState( QDataStream& s )
+{
+    s << (qint32)m_pinMode << m_outState << m_nextState << m_inpState << m_stateZ << m_step;
+    s << m_outHighV << m_outLowV << m_outVolt << m_vddAdmit << m_gndAdmit << m_vddAdmEx << m_gndAdmEx << m_admit;
+    return true;
+}
+
+bool IoPin::loadState( QDataStream& s, bool check )
+{
+    qint32 pinMode;
+    bool outState, nextState, inpState, stateZ;
+    double step, outHighV, outLowV, outVolt, vddAdmit, gndAdmit, vddAdmEx, gndAdmEx, admit;
+    s >> pinMode >> outState >> nextState >> inpState >> stateZ >> step;
+    s >> outHighV >> outLowV >> outVolt >> vddAdmit >> gndAdmit >> vddAdmEx >> gndAdmEx >> admit;
+    if( check || s.status() != QDataStream::Ok ) return s.status() == QDataStream::Ok;
+
+    m_pinMode   = (pinMode_t)pinMode;
+    m_outState  = outState;
+    m_nextState = nextState;
+    m_inpState  = inpState;
+    m_stateZ    = stateZ;
+    m_step      = step;
+    m_outHighV  = outHighV;
+    m_outLowV   = outLowV;
+    m_outVolt   = outVolt;
+    m_vddAdmit  = vddAdmit;
+    m_gndAdmit  = gndAdmit;
+    m_vddAdmEx  = vddAdmEx;
+    m_gndAdmEx  = gndAdmEx;
+    m_admit     = admit;
+
+    if( !m_skipStamp ) stampAll();
+    return true;
+}
+
 void IoPin::scheduleState( bool state, uint64_t time )
 {
     if( m_nextState == state ) return;
@@ -35,6 +35,9 @@ class IoPin : public Pin, public eElement
         virtual void updateStep() override;
         virtual void runEvent() override;
 
+        virtual bool saveState( QDataStream& s ) override;
+        virtual bool loadState( QDataStream& s, bool check ) override;
+
         virtual void scheduleState( bool state, uint64_t time );
 
         //pinMode_t pinMode() { return m_pinMode; }
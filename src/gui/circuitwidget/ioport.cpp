@@ -4,6 +4,7 @@
  ***( see copyright.txt file at root folder )*******************************/
 
 #include <QDebug>
+#include <QDataStream>
 #include <math.h>
 
 #include "ioport.h"
@@ -47,6 +48,32 @@ void IoPort::runEvent()
     if( m_index > 0 ) nextStep();
 }
 
+bool IoPort::saveState( QDataStream& s )
+{
+    qint32 vector = m_index ? m_outVector-m_outVectors.data() : -1; // Sequence running
+    s << m_pinState << m_nextState << m_pinDirection << (qint32)m_pinMode << m_index << vector;
+    return true;
+}
+
+bool IoPort::loadState( QDataStream& s, bool check )
+{
+    uint pinState, nextState, pinDirection, index;
+    qint32 pinMode, vector;
+    s >> pinState >> nextState >> pinDirection >> pinMode >> index >> vector;
+    if( s.status() != QDataStream::Ok ) return false;
+    if( index && ( vector < 0 || vector >= (int)m_outVectors.size()
+                || index >= m_outVectors.at( vector ).size() ) ) return false;
+    if( check ) return true;
+
+    m_pinState  = pinState;
+    m_nextState = nextState;
+    m_pinDirection = pinDirection;
+    m_pinMode   = (pinMode_t)pinMode;
+    m_index     = index;
+    if( index ) m_outVector = &m_outVectors.at( vector );
+    return true;
+}
+
 void IoPort::trigger( uint n )
 {
     if( m_index != 0 ) return;             // Last sequence not finished
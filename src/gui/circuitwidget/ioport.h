@@ -29,6 +29,9 @@ class IoPort :public eElement
         void reset();
         virtual void runEvent() override;
 
+        virtual bool saveState( QDataStream& s ) override;
+        virtual bool loadState( QDataStream& s, bool check ) override;
+
         void scheduleState( uint32_t val, uint64_t time );
         void setOutState( uint32_t val );
         void setOutStatFast( uint32_t val );
@@ -64,6 +64,7 @@ bool Node::checkRemove() // Only remove if there are less than 3 connectors
             Pin* coPin = m_pin[i]->conPin();
             if( coPin->component() == this ) // Connector betwen 2 Pins of this node
             {
+                Circuit::self()->saveState( co );
                 co->setStartPin( NULL );
                 co->setEndPin( NULL );
                 Circuit::self()->removeConnector( co );
@@ -93,6 +94,9 @@ void Node::joinConns( int c0, int c1 )
     Connector* con1 = pin1->connector();
     if( !con0 || !con1 ) return;
 
+    Circuit::self()->saveState( con0 ); // Pins are unset before removing
+    Circuit::self()->saveState( con1 );
+
     if( pin1->conPin() != pin0 )
     {
         Connector* con = new Connector( "Connector", "Connector-"+Circuit::self()->newConnectorId(), pin0->conPin() );
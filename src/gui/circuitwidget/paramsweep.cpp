@@ -0,0 +1,417 @@
+/***************************************************************************
+ *   Copyright (C) 2023 by Santiago González                               *
+ *                                                                         *
+ ***( see copyright.txt file at root folder )*******************************/
+
+#include <QTextStream>
+#include <QFile>
+#include <QElapsedTimer>
+#include <QProgressDialog>
+#include <QCoreApplication>
+#include <QFileInfo>
+#include <QProcess>
+#include <QThread>
+#include <QDir>
+#include <QDebug>
+
+#include <stdio.h>
+
+#include "paramsweep.h"
+#include "simulator.h"
+#include "circuit.h"
+#include "component.h"
+#include "meter.h"
+#include "probe.h"
+#include "freqmeter.h"
+
+ParamSweep::ParamSweep()
+{
+    m_simTime = 1e9; // 1 ms
+    m_samples = 1;
+    m_worker  = false;
+    m_seed    = QRandomGenerator::global()->generate();
+}
+
+bool ParamSweep::loadFile( QString fileName )
+{
+    QFile file( fileName );
+    if( !file.open( QIODevice::ReadOnly | QIODevice::Text ) )
+    {
+        qDebug() << "ParamSweep::loadFile Error: can't open file" << fileName;
+        return false;
+    }
+    QTextStream in( &file );
+    in.setCodec("UTF-8");
+
+    int lineNum = 0;
+    while( !in.atEnd() )
+    {
+        QString line = in.readLine().trimmed();
+        lineNum++;
+        if( line.isEmpty() || line.startsWith("#") ) continue;
+
+        QStringList words = line.split(" ");
+        words.removeAll("");
+        QString type = words.takeFirst().toLower();
+        bool ok = true;
+
+        if( type == "time" && words.size() == 1 )
+            m_simTime = words.first().toDouble( &ok )*1e12;
+        else if( type == "measure" && words.size() == 1 )
+            addMeasure( words.first() );
+        else if( type == "values" && words.size() > 2 )
+        {
+            QString compId = words.takeFirst();
+            QString prop   = words.takeFirst();
+            QStringList values = words.join(" ").split(",");
+            for( QString& value : values ) value = value.trimmed();
+            values.removeAll("");
+            ok = addParam( compId, prop, values );
+        }
+        else if( type == "range" && words.size() == 5 )
+        {
+            bool ok1, ok2, ok3;
+            double min = words.at( 2 ).toDouble( &ok1 );
+            double max = words.at( 3 ).toDouble( &ok2 );
+            int  steps = words.at( 4 ).toInt( &ok3 );
+            ok = ok1 && ok2 && ok3 && steps > 0;
+            if( ok ) ok = addRange( words.at( 0 ), words.at( 1 ), min, max, steps );
+        }
+        else if( type == "tolerance" && words.size() == 4 )
+        {
+            bool ok1, ok2;
+            double percent = words.at( 2 ).toDouble( &ok1 );
+            int    samples = words.at( 3 ).toInt( &ok2 );
+            ok = ok1 && ok2 && samples > 0;
+            if( ok ) ok = addTolerance( words.at( 0 ), words.at( 1 ), percent, samples );
+        }
+        else ok = false;
+
+        if( !ok ){
+            qDebug() << "ParamSweep::loadFile Error at line" << lineNum << line;
+            return false;
+    }   }
+    m_fileName = fileName;
+    return true;
+}
+
+bool ParamSweep::addParam( QString compId, QString prop, QStringList values )
+{
+    Component* comp = Circuit::self()->getCompById( compId );
+    if( !comp || values.isEmpty() )
+    {
+        qDebug() << "ParamSweep Error: Component not found" << compId;
+        return false;
+    }
+    param_t param = { comp, prop, values };
+    m_params.append( param );
+    return true;
+}
+
+bool ParamSweep::addValues( QString compId, QString prop, QStringList values )
+{
+    return addParam( compId, prop, values );
+}
+
+bool ParamSweep::addRange( QString compId, QString prop, double min, double max, int steps )
+{
+    Component* comp = Circuit::self()->getCompById( compId );
+    if( !comp )
+    {
+        qDebug() << "ParamSweep Error: Component not found" << compId;
+        return false;
+    }
+
+    QString unit = comp->getPropStr( prop ).section(" ", 1 ); // Values in current unit
+    QStringList values;
+    for( int i=0; i<=steps; ++i )
+        values.append( QString::number( min+(max-min)*i/steps )+" "+unit );
+
+    return addParam( compId, prop, values );
+}
+
+bool ParamSweep::addTolerance( QString compId, QString prop, double percent, int samples )
+{
+    Component* comp = Circuit::self()->getCompById( compId );
+    if( !comp )
+    {
+        qDebug() << "ParamSweep Error: Component not found" << compId;
+        return false;
+    }
+    QString valStr = comp->getPropStr( prop );
+    tolerance_t tolerance = { comp, prop, valStr.section(" ", 0, 0 ).toDouble(), valStr.section(" ", 1 ), percent };
+    m_tolerances.append( tolerance );
+
+    if( m_tolerances.size() == 1 || samples > m_samples ) m_samples = samples;
+    return true;
+}
+
+int ParamSweep::variants()
+{
+    int runs = m_samples;
+    for( param_t param : m_params ) runs *= param.values.size();
+    return runs;
+}
+
+void ParamSweep::setup()
+{
+    m_meters.clear();
+    for( QString compId : m_measures )
+    {
+        Component* comp = Circuit::self()->getCompById( compId );
+        if( comp ) m_meters.append( comp );
+        else qDebug() << "ParamSweep Error: Component not found" << compId;
+    }
+    m_random.seed( m_seed ); // Draw all toleranced values together for each sample
+    m_draws.clear();
+    for( int i=0; i<m_samples; ++i )
+    {
+        QStringList values;
+        for( tolerance_t tol : m_tolerances )
+        {
+            double dev = (2*m_random.generateDouble()-1)*tol.percent/100; // Uniform in -percent, +percent
+            values.append( QString::number( tol.nominal*(1+dev) )+" "+tol.unit );
+        }
+        m_draws.append( values );
+}   }
+
+void ParamSweep::writeHeader( QTextStream& out )
+{
+    out << "Run";
+    for( param_t param : m_params )         out <<","<< param.comp->getUid()+":"+param.prop;
+    for( tolerance_t tol : m_tolerances )   out <<","<< tol.comp->getUid()+":"+tol.prop;
+    for( Component* comp : m_meters )       out <<","<< comp->getUid();
+    out << "\n";
+}
+
+bool ParamSweep::simulate( QProgressDialog* progress ) // Run to m_simTime keeping GUI responsive
+{
+    Simulator* sim = Simulator::self();
+    uint64_t chunk = m_simTime/100+1;
+    uint64_t time = 0;
+
+    QElapsedTimer timer;
+    timer.start();
+    while( time < m_simTime )
+    {
+        time += chunk;
+        if( time > m_simTime ) time = m_simTime;
+        if( !sim->runTo( time ) ) return false;
+
+        if( timer.elapsed() < 100 ) continue; // Process GUI events every 100 ms
+        timer.restart();
+
+        sim->pauseSim();                      // Simulator timer must not run the Circuit now
+        QCoreApplication::processEvents();
+        sim->resumeSim();
+        if( progress && progress->wasCanceled() ) return false;
+    }
+    return true;
+}
+
+double ParamSweep::measure( Component* comp )
+{
+    comp->updateStep(); // Meters calculate their value at GUI update
+
+    if( Meter* meter = dynamic_cast<Meter*>( comp ) )       return meter->value();
+    if( Probe* probe = dynamic_cast<Probe*>( comp ) )       return probe->volt();
+    if( FreqMeter* fMeter = dynamic_cast<FreqMeter*>( comp ) ) return fMeter->freq();
+    return 0;
+}
+
+bool ParamSweep::run( QString csvFile, QProgressDialog* progress )
+{
+    Simulator* sim = Simulator::self();
+    if( sim->isRunning() ) return false;
+
+    setup();
+    int runs = variants();
+    if( progress ) progress->setMaximum( runs );
+
+    int workers = qMin( QThread::idealThreadCount(), runs );
+    if( workers > 1 && !m_fileName.isEmpty() )
+    {
+        if( runParallel( csvFile, workers, progress ) ) return true;
+        if( progress && progress->wasCanceled() ) return true;
+        qDebug() << "ParamSweep::run: worker processes failed, running in this process";
+    }
+    QFile file( csvFile );
+    if( !file.open( QIODevice::WriteOnly | QIODevice::Text ) )
+    {
+        qDebug() << "ParamSweep::run Error: can't open file" << csvFile;
+        return false;
+    }
+    QTextStream out( &file );
+    out.setCodec("UTF-8");
+    out.setLocale( QLocale::C );
+    writeHeader( out );
+
+    QStringList initValues;                // Restore Circuit when done
+    for( param_t param : m_params )       initValues.append( param.comp->getPropStr( param.prop ) );
+    for( tolerance_t tol : m_tolerances ) initValues.append( tol.comp->getPropStr( tol.prop ) );
+
+    runRange( out, 0, runs, progress );
+
+    int i = 0;
+    for( param_t param : m_params )       param.comp->setPropStr( param.prop, initValues.at( i++ ) );
+    for( tolerance_t tol : m_tolerances ) tol.comp->setPropStr( tol.prop, initValues.at( i++ ) );
+
+    file.close();
+    return true;
+}
+
+bool ParamSweep::runWorker( QString csvFile, int first, int count )
+{
+    QFile file( csvFile );
+    if( !file.open( QIODevice::WriteOnly | QIODevice::Text ) )
+    {
+        qDebug() << "ParamSweep::runWorker Error: can't open file" << csvFile;
+        return false;
+    }
+    QTextStream out( &file );
+    out.setCodec("UTF-8");
+    out.setLocale( QLocale::C );
+
+    m_worker = true;
+    setup();
+    runRange( out, first, count, NULL );
+
+    file.close();
+    return true;
+}
+
+void ParamSweep::runRange( QTextStream& out, int first, int count, QProgressDialog* progress )
+{
+    Simulator* sim = Simulator::self();
+    int combos = variants()/m_samples;
+
+    for( int run=first; run<first+count; ++run )
+    {
+        if( progress ){
+            progress->setValue( run );
+            if( progress->wasCanceled() ) break;
+        }
+        out << run;
+        int combo = run%combos;
+        for( param_t param : m_params ) // Values/range combination
+        {
+            QString value = param.values.at( combo%param.values.size() );
+            combo /= param.values.size();
+            param.comp->setPropStr( param.prop, value );
+            out <<","<< value;
+        }
+        QStringList draws = m_draws.at( run/combos ); // Monte-Carlo sample
+        for( int i=0; i<m_tolerances.size(); ++i )
+        {
+            m_tolerances.at( i ).comp->setPropStr( m_tolerances.at( i ).prop, draws.at( i ) );
+            out <<","<< draws.at( i );
+        }
+        sim->startSim();
+        bool ok = simulate( progress );
+        bool canceled = progress && progress->wasCanceled();
+
+        for( Component* comp : m_meters )
+        {
+            if     ( ok )       out <<","<< measure( comp );
+            else if( canceled ) out <<",Canceled";
+            else                out <<",Error";
+        }
+        out << "\n";
+        sim->stopSim();
+        if( canceled ) break;
+
+        if( m_worker ){         // Report run done to main process
+            out.flush();
+            printf("run %i\n", run );
+            fflush( stdout );
+}   }   }
+
+bool ParamSweep::runParallel( QString csvFile, int workers, QProgressDialog* progress )
+{
+    // Workers load the Circuit as it is now: save it next to the original to keep relative paths
+    QString circFile = Circuit::self()->getFilePath();
+    QString dir = circFile.isEmpty() ? QDir::tempPath() : QFileInfo( circFile ).absolutePath();
+    circFile = dir+"/.sweep_"+QString::number( QCoreApplication::applicationPid() )+".sim1";
+
+    QFile circ( circFile );
+    if( !circ.open( QIODevice::WriteOnly | QIODevice::Text ) ) return false;
+    QTextStream circOut( &circ );
+    circOut.setCodec("UTF-8");
+    circOut << Circuit::self()->circuitToString();
+    circ.close();
+
+    int runs = variants();
+    int done = 0;
+    int first = 0;
+    QList<QProcess*> procs;
+    QStringList parts;
+    for( int i=0; i<workers; ++i ) // Each worker runs a contiguous block of runs
+    {
+        int count = runs/workers + ( (i < runs%workers) ? 1 : 0 );
+        QString part = csvFile+"."+QString::number( i );
+        parts.append( part );
+
+        QProcess* proc = new QProcess();
+        QObject::connect( proc, &QProcess::readyReadStandardOutput, [proc, &done](){
+            while( proc->canReadLine() ) if( proc->readLine().startsWith("run") ) done++;
+        });
+        proc->start( QCoreApplication::applicationFilePath(),
+                   { "-platform", "offscreen", circFile
+                   , "--sweep", m_fileName
+                   , "--seed" , QString::number( m_seed )
+                   , "--runs" , QString::number( first ), QString::number( count )
+                   , "--out"  , part } );
+        procs.append( proc );
+        first += count;
+    }
+    bool canceled = false;
+    bool running  = true;
+    while( running )
+    {
+        running = false;
+        for( QProcess* proc : procs )
+            if( proc->state() != QProcess::NotRunning && !proc->waitForFinished( 20 ) ) running = true;
+
+        if( !progress ) continue;
+        progress->setValue( done );
+        QCoreApplication::processEvents();
+        if( progress->wasCanceled() )
+        {
+            canceled = true;
+            for( QProcess* proc : procs ) proc->kill();
+            for( QProcess* proc : procs ) proc->waitForFinished();
+            break;
+    }   }
+    bool ok = true;
+    for( QProcess* proc : procs )
+    {
+        if( proc->exitStatus() != QProcess::NormalExit || proc->exitCode() != 0 ) ok = false;
+        delete proc;
+    }
+    QFile::remove( circFile );
+
+    if( ok || canceled )   // Collect worker results
+    {
+        QFile file( csvFile );
+        if( !file.open( QIODevice::WriteOnly | QIODevice::Text ) )
+        {
+            qDebug() << "ParamSweep::run Error: can't open file" << csvFile;
+            ok = false;
+        }else{
+            QTextStream out( &file );
+            out.setCodec("UTF-8");
+            out.setLocale( QLocale::C );
+            writeHeader( out );
+            out.flush();
+
+            for( QString part : parts )
+            {
+                QFile partFile( part );
+                if( partFile.open( QIODevice::ReadOnly ) ) file.write( partFile.readAll() );
+            }
+            file.close();
+    }   }
+    for( QString part : parts ) QFile::remove( part );
+
+    return ok;
+}
@@ -0,0 +1,89 @@
+/***************************************************************************
+ *   Copyright (C) 2023 by Santiago González                               *
+ *                                                                         *
+ ***( see copyright.txt file at root folder )*******************************/
+
+#ifndef PARAMSWEEP_H
+#define PARAMSWEEP_H
+
+#include <QStringList>
+#include <QList>
+#include <QRandomGenerator>
+
+class Component;
+class QProgressDialog;
+class QTextStream;
+
+// Runs the loaded Circuit once per combination of property values
+// and writes the meters/probes readings at the end of each run to a CSV table.
+//
+// Sweep file, one entry per line ( # for comments ):
+//   time      <simulation time in seconds>
+//   values    <compId> <property> <value1>, <value2>, ...   ( values with unit: 4.7 kΩ )
+//   range     <compId> <property> <min> <max> <steps>       ( in current property unit )
+//   tolerance <compId> <property> <percent> <samples>       ( uniform random around current value )
+//   measure   <compId>                                      ( Voltimeter, Amperimeter, FreqMeter or Probe )
+//
+// Toleranced properties are drawn together in each Monte-Carlo sample ( largest samples entry ),
+// each sample is run for every combination of values/range entries.
+// Runs are split between worker processes that load the Circuit once each.
+
+class ParamSweep
+{
+    public:
+        ParamSweep();
+
+        bool loadFile( QString fileName );
+
+        void setSimTime( uint64_t ps ) { m_simTime = ps; }
+        void setSeed( quint32 seed ) { m_seed = seed; }
+
+        bool addValues( QString compId, QString prop, QStringList values );
+        bool addRange( QString compId, QString prop, double min, double max, int steps );
+        bool addTolerance( QString compId, QString prop, double percent, int samples );
+        void addMeasure( QString compId ) { m_measures.append( compId ); }
+
+        int  variants(); // Number of runs
+        bool run( QString csvFile, QProgressDialog* progress=NULL ); // progress: show runs done, can cancel
+        bool runWorker( QString csvFile, int first, int count );     // Rows only, report runs done to stdout
+
+    private:
+        struct param_t{
+            Component*  comp;
+            QString     prop;
+            QStringList values;
+        };
+        struct tolerance_t{
+            Component* comp;
+            QString    prop;
+            double     nominal;
+            QString    unit;
+            double     percent;
+        };
+
+        bool addParam( QString compId, QString prop, QStringList values );
+        void setup();
+        void writeHeader( QTextStream& out );
+        void runRange( QTextStream& out, int first, int count, QProgressDialog* progress );
+        bool runParallel( QString csvFile, int workers, QProgressDialog* progress );
+        bool simulate( QProgressDialog* progress );
+        double measure( Component* comp );
+
+        uint64_t m_simTime;
+
+        int m_samples;                // Monte-Carlo samples
+        bool m_worker;
+
+        quint32 m_seed;               // Same draws in all worker processes
+        QRandomGenerator m_random;
+
+        QString m_fileName;
+
+        QList<param_t>     m_params;
+        QList<tolerance_t> m_tolerances;
+        QList<QStringList> m_draws;   // Toleranced values for each sample
+        QList<Component*>  m_meters;
+        QStringList        m_measures;
+};
+
+#endif
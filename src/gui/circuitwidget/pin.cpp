@@ -16,6 +16,7 @@
 #include "connectorline.h"
 #include "circuit.h"
 #include "simulator.h"
+#include "e-node.h"
 
 Pin::Pin( int angle, const QPoint pos, QString id, int index, Component* parent, int length )
    : QGraphicsItem( parent )
@@ -141,6 +142,26 @@ void  Pin::setConnector( Connector* connector )
     }
 }
 
+Pin* Pin::linkedPin()
+{
+    eNode* enode = getEnode();
+    if( !enode ) return NULL;
+
+    Pin* linked = NULL;
+    for( ePin* epin : enode->getEpins() )
+    {
+        if( epin == this ) continue;
+        Pin* other = dynamic_cast<Pin*>( epin );
+        if( !other ) return NULL;
+
+        QString type = other->component()->itemType();
+        if( type == "Node" || type == "Tunnel" ) continue;
+        if( linked ) return NULL;      // Some other load attached
+        linked = other;
+    }
+    return linked;
+}
+
 void Pin::removeConnector()
 {
     if( my_connector ) Circuit::self()->removeConnector( my_connector );
@@ -70,6 +70,7 @@ class Pin : public QGraphicsItem, public ePin, public Updatable
         Pin* conPin(){ return m_conPin; }
 
         Pin* connectPin( bool connect );
+        Pin* linkedPin(); // The only Pin connected to this one (wires don't count)
 
         QString getLabelText() { return m_labelText; }
         virtual void setLabelText( QString label, bool over=true );
@@ -321,24 +321,7 @@ void Chip::paint( QPainter* p, const QStyleOptionGraphicsItem* o, QWidget* w )
     if( m_backPixmap ) p->drawPixmap( QRect(m_area.x(), m_area.y(), m_width*8, m_height*8), *m_backPixmap );
     else{
         p->drawRoundedRect( m_area, 1, 1);
-        if( m_backData  )
-        {
-            double w = m_backData->size();
-            double h = m_backData->at(0).size();
-
-            QImage img( w*3, h*3, QImage::Format_RGB32 );
-            QPainter painter;
-            painter.begin( &img );
-
-            for( int col=0; col<w; col++ )
-            {
-                int x = col*3;
-                for( int y=0; y<h; y++ )
-                    painter.fillRect( QRectF( x, y*3, 3, 3 ), QColor(m_backData->at(col).at(y) ) );
-            }
-            painter.end();
-            p->drawImage( m_area, img );
-        }
+        if( m_backData ) p->drawImage( m_area, *m_backData );
         else if( !m_isLS && m_background.isEmpty() )
         {
             p->setPen( QColor( 170, 170, 150 ) );
@@ -10,6 +10,7 @@
 #include "e-element.h"
 
 class QDomElement;
+class QImage;
 
 class Chip : public Component, public eElement
 {
@@ -26,6 +27,8 @@ class Chip : public Component, public eElement
         };
 
         virtual bool setPropStr( QString prop, QString val ) override;
+        virtual bool saveState( QDataStream& ) override { return true; }
+        virtual bool loadState( QDataStream&, bool ) override { return true; }
 
         QString package() { return m_package; }
         virtual void setPackage( QString package );
@@ -45,7 +48,7 @@ class Chip : public Component, public eElement
 
         int pkgWidth() { return m_width; }
 
-        void setBackData( std::vector<std::vector<int>>* d ) { m_backData = d; }
+        void setBackData( QImage* d ) { m_backData = d; }
 
         virtual void setflip() override;
 
@@ -85,7 +88,7 @@ class Chip : public Component, public eElement
         QString m_package;
         QList<Pin*> m_unusedPins;
 
-        std::vector<std::vector<int>>* m_backData;
+        QImage* m_backData;
 
         QGraphicsTextItem m_label;
 };
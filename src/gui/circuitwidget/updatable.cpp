@@ -6,7 +6,12 @@
 #include "updatable.h"
 #include "simulator.h"
 
-Updatable::Updatable(){}
+Updatable::Updatable()
+{
+    m_viewItem = NULL;
+    m_dirtyDriven = false;
+    m_dirty = true;
+}
 Updatable::~Updatable()
 {
     Simulator::self()->remFromUpdateList( this );
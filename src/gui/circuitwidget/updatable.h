@@ -6,6 +6,9 @@
 #ifndef UPDATABLE_H
 #define UPDATABLE_H
 
+#include <atomic>
+#include <QGraphicsItem>
+
 class Updatable
 {
     public:
@@ -13,6 +16,26 @@ class Updatable
         ~Updatable();
 
         virtual void updateStep(){;}
+
+        // GUI refresh scheduling, optional:
+        // View item: updateStep() only paints this item, skip it if out of view.
+        // Dirty driven: updateStep() only if simulation called setDirty() since last one.
+        void setViewItem( QGraphicsItem* item ) { m_viewItem = item; }
+        void setDirtyDriven( bool d ) { m_dirtyDriven = d; }
+        void setDirty() { m_dirty.store( true, std::memory_order_relaxed ); }
+
+        inline bool needUpdate( const QRectF& viewRect )
+        {
+            if( m_viewItem && !m_viewItem->sceneBoundingRect().intersects( viewRect ) ) return false;
+            if( m_dirtyDriven ) return m_dirty.exchange( false, std::memory_order_relaxed );
+            return true;
+        }
+
+    private:
+        QGraphicsItem* m_viewItem;
+
+        bool m_dirtyDriven;
+        std::atomic<bool> m_dirty;
 };
 
 #endif
@@ -0,0 +1,323 @@
+/***************************************************************************
+ *   Copyright (C) 2023 by Santiago González                               *
+ *                                                                         *
+ ***( see copyright.txt file at root folder )*******************************/
+
+#include <qtconcurrentrun.h>
+#include <QTextStream>
+#include <QThread>
+#include <QDebug>
+
+#include <string.h>
+
+#include "datacapture.h"
+
+static const char capMagic[8] = { 'S','I','M','U','C','A','P','1' };
+
+// Sequential reader for capture files, reads in chunks
+class CapReader
+{
+    public:
+        CapReader( QString fileName ) : m_file( fileName ) { m_pos = 0; m_ok = false; }
+
+        bool open( bool* analog, QStringList* names )
+        {
+            if( !m_file.open( QIODevice::ReadOnly ) ) return false;
+
+            QByteArray header = m_file.read( 10 );
+            if( header.size() < 10 || memcmp( header.constData(), capMagic, 8 ) != 0 ) return false;
+
+            *analog = header.at( 8 );
+            int numChannels = (uint8_t)header.at( 9 );
+            for( int i=0; i<numChannels; ++i )
+            {
+                char len = 0;
+                if( !m_file.getChar( &len ) ) return false;
+                names->append( QString::fromUtf8( m_file.read( (uint8_t)len ) ) );
+            }
+            m_ok = true;
+            return true;
+        }
+
+        bool next( uint64_t* time, int* channel, double* value, bool analog ) // Decode one record
+        {
+            if( !fill( 24 ) ) return false;
+
+            *time += getVarint();
+            if( m_pos >= m_buffer.size() ) return false;
+
+            *channel = (uint8_t)m_buffer.at( m_pos++ );
+            if( analog ){
+                if( m_pos+(int)sizeof(double) > m_buffer.size() ) return false;
+                memcpy( value, m_buffer.constData()+m_pos, sizeof(double) );
+                m_pos += sizeof(double);
+            }
+            else *value = getVarint();
+            return m_pos <= m_buffer.size();
+        }
+
+    private:
+        bool fill( int bytes )
+        {
+            if( !m_ok ) return false;
+            if( m_buffer.size()-m_pos >= bytes ) return true;
+
+            m_buffer = m_buffer.mid( m_pos )+m_file.read( 256*1024 );
+            m_pos = 0;
+            return !m_buffer.isEmpty();
+        }
+        uint64_t getVarint()
+        {
+            uint64_t v = 0;
+            int shift = 0;
+            while( m_pos < m_buffer.size() )
+            {
+                uint8_t b = m_buffer.at( m_pos++ );
+                v |= (uint64_t)(b & 0x7F) << shift;
+                if( !(b & 0x80) ) break;
+                shift += 7;
+            }
+            return v;
+        }
+
+        QFile m_file;
+        QByteArray m_buffer;
+        int m_pos;
+        bool m_ok;
+};
+
+DataCapture::DataCapture()
+{
+    m_capturing = false;
+    m_running = false;
+    m_current = NULL;
+    m_head = 0;
+    m_tail = 0;
+    m_pool.setMaxThreadCount( 1 );
+}
+DataCapture::~DataCapture()
+{
+    stop();
+}
+
+bool DataCapture::start( QString fileName, bool analog, QStringList names )
+{
+    stop();
+    m_pool.waitForDone(); // Previous conversion could be reading this file
+
+    m_file.setFileName( fileName );
+    if( !m_file.open( QIODevice::WriteOnly | QIODevice::Truncate ) )
+    {
+        qDebug() << "DataCapture::start Error: can't open file" << fileName;
+        return false;
+    }
+    QByteArray header( capMagic, 8 );
+    header.append( (char)( analog ? 1 : 0 ) );
+    header.append( (char)names.size() );
+    for( QString name : names )
+    {
+        QByteArray n = name.toUtf8().left( 255 );
+        header.append( (char)n.size() );
+        header.append( n );
+    }
+    m_file.write( header );
+
+    if( m_blocks.empty() ) m_blocks.resize( numBlocks );
+    m_head = 0;
+    m_tail = 0;
+    m_current = &m_blocks[0];
+    m_current->size = 0;
+
+    m_analog   = analog;
+    m_lastTime = 0;
+    m_dropped  = 0;
+    m_running  = true;
+    m_capturing = true;
+
+    m_writer = QtConcurrent::run( &m_pool, this, &DataCapture::writeLoop );
+    return true;
+}
+
+void DataCapture::stop()
+{
+    if( !m_capturing ) return;
+    m_capturing = false;
+
+    if( m_current && m_current->size ) // Push last partial block
+    {
+        while( m_head-m_tail >= numBlocks-1 ) QThread::msleep( 1 );
+        pushBlock();
+    }
+    m_running = false;
+    m_writer.waitForFinished();
+    m_file.close();
+    m_current = NULL;
+
+    if( m_dropped ) qDebug() << "DataCapture: Disk too slow," << m_dropped << "samples lost";
+}
+
+void DataCapture::convertAsync( uint64_t timeStep )
+{
+    QtConcurrent::run( &m_pool, &DataCapture::convert, m_file.fileName(), timeStep );
+}
+
+void DataCapture::putVarint( uint64_t v )
+{
+    uint8_t* data = m_current->data;
+    int size = m_current->size;
+    while( v >= 0x80 ){
+        data[size++] = (v & 0x7F) | 0x80;
+        v >>= 7;
+    }
+    data[size++] = v;
+    m_current->size = size;
+}
+
+void DataCapture::addSample( uint64_t time, int channel, double value )
+{
+    if( !m_current ) return;
+
+    if( m_current->size > blockSize-32 ) // Block full: try to get a free one
+    {
+        if( m_head-m_tail >= numBlocks-1 ) { m_dropped++; return; } // Writer can't keep pace
+        pushBlock();
+    }
+    putVarint( time-m_lastTime );
+    m_lastTime = time;
+
+    m_current->data[m_current->size++] = channel;
+
+    if( m_analog ){
+        memcpy( m_current->data+m_current->size, &value, sizeof(double) );
+        m_current->size += sizeof(double);
+    }
+    else putVarint( (uint64_t)value );
+}
+
+void DataCapture::pushBlock()
+{
+    uint32_t head = m_head.load( std::memory_order_relaxed )+1;
+    m_head.store( head, std::memory_order_release );
+
+    m_current = &m_blocks[head%numBlocks];
+    m_current->size = 0;
+}
+
+void DataCapture::writeLoop()
+{
+    while( true )
+    {
+        uint32_t tail = m_tail.load( std::memory_order_relaxed );
+        if( tail != m_head.load( std::memory_order_acquire ) )
+        {
+            block_t* block = &m_blocks[tail%numBlocks];
+            m_file.write( (const char*)block->data, block->size );
+            m_tail.store( tail+1, std::memory_order_release );
+        }
+        else if( !m_running ) break;
+        else QThread::msleep( 2 );
+    }
+    m_file.flush();
+}
+
+bool DataCapture::toVcd( QString capFile, QString vcdFile, uint64_t timeStep )
+{
+    QChar identifiers[8] = {'*', '"', '#', '$', '%', '&', '(', ')'};
+
+    bool analog = false;
+    QStringList names;
+    CapReader reader( capFile );
+    if( !reader.open( &analog, &names ) ) return false;
+
+    QFile file( vcdFile );
+    if( !file.open( QIODevice::WriteOnly | QIODevice::Text ) ) return false;
+
+    QTextStream out( &file );
+    out.setLocale( QLocale::C );
+
+    if( timeStep < 1 ) timeStep = 1;
+    out <<"$timescale "<< timeStep <<"ps $end"<< endl<< endl;
+    for( int ch=0; ch<names.size() && ch<8; ++ch )
+        out << "$var wire 1 " << identifiers[ch] <<" "<< names.at( ch ) <<" $end\n";
+    out << endl <<"$enddefinitions $end"<< endl;
+
+    uint64_t time = 0;
+    uint64_t lastStamp = 0;
+    bool first = true;
+    int channel;
+    double value;
+
+    while( reader.next( &time, &channel, &value, analog ) )
+    {
+        if( channel >= 8 ) continue;
+        uint64_t stamp = time/timeStep;
+        if( first || stamp != lastStamp )
+        {
+            out << endl <<"#"<< stamp;
+            lastStamp = stamp;
+            first = false;
+        }
+        out <<" "<< value << identifiers[channel];
+    }
+    out << endl <<"#"<< lastStamp+1; // last time stamp
+    file.close();
+    return true;
+}
+
+bool DataCapture::toCsv( QString capFile, QString csvFile )
+{
+    bool analog = false;
+    QStringList names;
+    CapReader reader( capFile );
+    if( !reader.open( &analog, &names ) ) return false;
+
+    QFile file( csvFile );
+    if( !file.open( QIODevice::WriteOnly | QIODevice::Text ) ) return false;
+
+    QTextStream out( &file );
+    out.setLocale( QLocale::C );
+
+    out << "Time(ps)";
+    for( QString name : names ) out <<","<< name;
+    out << endl;
+
+    std::vector<double> values( names.size(), 0 );
+    uint64_t time = 0;
+    uint64_t rowTime = 0;
+    bool pending = false;
+    int channel;
+    double value;
+
+    while( reader.next( &time, &channel, &value, analog ) )
+    {
+        if( channel >= (int)values.size() ) continue;
+        if( pending && time != rowTime ) // New time: write previous row
+        {
+            out << rowTime;
+            for( double v : values ) out <<","<< v;
+            out << "\n";
+        }
+        values[channel] = value;
+        rowTime = time;
+        pending = true;
+    }
+    if( pending ){
+        out << rowTime;
+        for( double v : values ) out <<","<< v;
+        out << "\n";
+    }
+    file.close();
+    return true;
+}
+
+void DataCapture::convert( QString capFile, uint64_t timeStep )
+{
+    bool analog = false;
+    QStringList names;
+    CapReader reader( capFile );
+    if( !reader.open( &analog, &names ) ) return;
+
+    QString baseName = capFile.left( capFile.lastIndexOf(".") );
+    if( analog ) toCsv( capFile, baseName+".csv" );
+    else         toVcd( capFile, baseName+".vcd", timeStep );
+}
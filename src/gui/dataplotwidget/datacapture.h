@@ -0,0 +1,76 @@
+/***************************************************************************
+ *   Copyright (C) 2023 by Santiago González                               *
+ *                                                                         *
+ ***( see copyright.txt file at root folder )*******************************/
+
+#ifndef DATACAPTURE_H
+#define DATACAPTURE_H
+
+#include <atomic>
+#include <vector>
+
+#include <QFile>
+#include <QFuture>
+#include <QThreadPool>
+#include <QStringList>
+
+// Streams channel samples to a binary file without keeping them in RAM.
+// Simulation thread fills blocks of compressed records (delta time + value),
+// a background writer drains the blocks to disk.
+// Record: varint( deltaTime ), uint8 channel, value
+//         value = varint( uint ) for digital or raw double for analog.
+
+class DataCapture
+{
+    public:
+        DataCapture();
+        ~DataCapture();
+
+        bool start( QString fileName, bool analog, QStringList names );
+        void stop();
+
+        bool isCapturing() { return m_capturing; }
+        QString fileName() { return m_file.fileName(); }
+        uint64_t dropped() { return m_dropped; }
+
+        void addSample( uint64_t time, int channel, double value ); // Called from Simulation thread
+
+ static bool toVcd( QString capFile, QString vcdFile, uint64_t timeStep );
+ static bool toCsv( QString capFile, QString csvFile );
+ static void convert( QString capFile, uint64_t timeStep ); // VCD for digital, CSV for analog
+
+        void convertAsync( uint64_t timeStep ); // Convert last capture in writer thread
+
+    private:
+ static const int blockSize = 64*1024;
+ static const int numBlocks = 64;     // Max 4 MB waiting to be written
+
+        struct block_t{
+            int size;
+            uint8_t data[blockSize];
+        };
+
+        inline void putVarint( uint64_t v );
+        void pushBlock();
+        void writeLoop();
+
+        std::vector<block_t> m_blocks;
+        block_t* m_current;
+
+        std::atomic<uint32_t> m_head; // Blocks pushed  (Simulation thread)
+        std::atomic<uint32_t> m_tail; // Blocks written (Writer thread)
+        std::atomic<bool> m_running;
+
+        bool m_capturing;
+        bool m_analog;
+
+        uint64_t m_lastTime;
+        uint64_t m_dropped;
+
+        QFile m_file;
+
+        QThreadPool   m_pool;
+        QFuture<void> m_writer;
+};
+
+#endif
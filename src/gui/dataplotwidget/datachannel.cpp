@@ -6,6 +6,7 @@
 #include "datachannel.h"
 #include "plotdisplay.h"
 #include "plotbase.h"
+#include "datacapture.h"
 #include "simulator.h"
 #include "e-node.h"
 #include "pin.h"
@@ -20,7 +21,10 @@ DataChannel::DataChannel( PlotBase* plotBase, QString id )
     m_ePin[1] = NULL;
     m_chTunnel = "";
     m_trigIndex = 0;
+    m_bufferCounter = 0;
     m_pauseOnCond = false;
+    m_capture = NULL;
+    m_dispSize = 0;
 }
 DataChannel::~DataChannel(){}
 
@@ -37,10 +41,43 @@ void DataChannel::stamp()    // Called at Simulation Start
     }
     m_plotBase->display()->connectChannel( m_channel, connected );
 
+    m_capture = m_plotBase->startCapture();
+
     if( !m_ePin[1] ) return;
     m_ePin[1]->changeCallBack( this );
 }
 
+// Copy samples from trigger point back to timeStart into the display snapshot.
+// Called from updateStep, while Simulation thread is not running,
+// so PlotDisplay never reads the buffers Simulation thread is writing.
+void DataChannel::publish( double timeStart )
+{
+    int size = m_buffer.size();
+    if( m_dispBuffer.size() != size )
+    {
+        m_dispBuffer.resize( size );
+        m_dispTime.resize( size );
+    }
+    const double*   buffer = m_buffer.constData();
+    const uint64_t* times  = m_time.constData();
+    double*   dispBuffer = m_dispBuffer.data();
+    uint64_t* dispTime   = m_dispTime.data();
+
+    int pos = m_trigIndex;
+    if( pos >= size ) pos = 0; // Buffer size changed
+    int n = 0;
+    while( n < size )
+    {
+        uint64_t time = times[pos];
+        dispBuffer[n] = buffer[pos];
+        dispTime[n]   = time;
+        n++;
+        if( time <= timeStart ) break;
+        if( --pos < 0 ) pos += size;
+    }
+    m_dispSize = n;
+}
+
 bool DataChannel::isBus()
 {
     if( m_pin ) return m_pin->isBus();
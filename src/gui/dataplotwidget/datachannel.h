@@ -20,6 +20,7 @@ enum cond_t{
 };
 
 class PlotBase;
+class DataCapture;
 class Pin;
 
 class DataChannel : public eElement, public Updatable
@@ -43,10 +44,16 @@ class DataChannel : public eElement, public Updatable
 
         QString getChName() { return m_chTunnel; }
 
+        void publish( double timeStart );
+
     protected:
         QVector<double> m_buffer;
         QVector<uint64_t> m_time;
 
+        QVector<double>   m_dispBuffer; // Snapshot for PlotDisplay: newest first
+        QVector<uint64_t> m_dispTime;
+        int m_dispSize;
+
         bool m_connected;
         bool m_rising;
         bool m_falling;
@@ -67,6 +74,8 @@ class DataChannel : public eElement, public Updatable
 
         Pin* m_pin;
 
+        DataCapture* m_capture; // Not NULL while streaming to file
+
         PlotBase* m_plotBase;
 };
 
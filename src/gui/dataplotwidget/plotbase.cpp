@@ -5,6 +5,7 @@
 
 #include "plotbase.h"
 #include "plotdisplay.h"
+#include "datacapture.h"
 #include "simulator.h"
 #include "circuit.h"
 #include "circuitwidget.h"
@@ -67,6 +68,10 @@ PlotBase::PlotBase( QString type, QString id )
     m_autoExport = false;
     m_exportFile = changeExt( Circuit::self()->getFilePath(), "_"+id+".vcd" );
 
+    m_capture = false;
+    m_analog  = false;
+    m_dataCapture = new DataCapture();
+
     addPropGroup( { tr("Main"), {
         new IntProp <PlotBase>("Basic_X",tr("Screen Width"), "_px"
                               , this, &PlotBase::baSizeX, &PlotBase::setBaSizeX,0,"uint" ),
@@ -84,6 +89,14 @@ PlotBase::PlotBase( QString type, QString id )
                               , this, &PlotBase::inputImped, &PlotBase::setInputImped )
     }, groupNoCopy} );
 
+    addPropGroup( { tr("Capture"), {
+        new BoolProp<PlotBase>("Capture",tr("Stream to file"),""
+                              , this, &PlotBase::capture, &PlotBase::setCapture ),
+
+        new StrProp <PlotBase>("CaptureFile",tr("Capture File"),""
+                              , this, &PlotBase::captureFile, &PlotBase::setCaptureFile ),
+    }, groupNoCopy} );
+
     addPropGroup( {"Hidden", {
         new StrProp<PlotBase>("TimDiv" ,"",""
                              , this, &PlotBase::timDiv, &PlotBase::setTimDiv ),
@@ -106,6 +119,7 @@ PlotBase::PlotBase( QString type, QString id )
 }
 PlotBase::~PlotBase()
 {
+    delete m_dataCapture;
     for( int i=0; i<m_numChannels; i++ ) delete m_channel[i];
 }
 
@@ -137,11 +151,7 @@ void PlotBase::setBufferSize( int bs )
     if( bs < 0 || bs > 10000000 ) bs = 10000000;
     else if( bs < 1000 ) bs = 1000;
     m_bufferSize = bs;
-    for( int i=0; i<m_numChannels; i++ )
-    {
-        m_channel[i]->m_buffer.resize( m_bufferSize );
-        m_channel[i]->m_time.resize( m_bufferSize );
-    }
+    if( !Simulator::self()->isRunning() ) publishData(); // If running, resize in next updateStep
 }
 
 void PlotBase::setConnectGnd( bool c )
@@ -176,6 +186,32 @@ void PlotBase::setTimeDiv( uint64_t td )
 {
     m_display->setTimeDiv( td );
     m_timeDiv = m_display->m_timeDiv;
+    updateDisplay();
+}
+
+void PlotBase::publishData() // Update display snapshots of all channels
+{
+    for( int i=0; i<m_numChannels; i++ ) publishChannel( i );
+}
+
+void PlotBase::publishChannel( int i )
+{
+    DataChannel* ch = m_channel[i];
+    if( ch->m_buffer.size() != m_bufferSize ) // Simulation thread is not running here
+    {
+        ch->m_buffer.resize( m_bufferSize );
+        ch->m_time.resize( m_bufferSize );
+        if( ch->m_bufferCounter >= m_bufferSize ) ch->m_bufferCounter = 0;
+        if( ch->m_trigIndex >= m_bufferSize )     ch->m_trigIndex = 0;
+    }
+    ch->publish( m_display->chanTimeStart( i ) );
+}
+
+void PlotBase::updateDisplay()
+{
+    if( Simulator::self()->isRunning() ) return; // Published in next updateStep
+    publishData();
+    m_display->update();
 }
 
 QString PlotBase::tunnels()
@@ -252,6 +288,34 @@ void PlotBase::conditonMet( int ch, cond_t cond )
     }*/
 }
 
+DataCapture* PlotBase::startCapture() // Called by channels at Simulation start
+{
+    if( !m_capture ) return NULL;
+    if( m_dataCapture->isCapturing() ) return m_dataCapture;
+
+    QString fileName = m_captureFile;
+    if( fileName.isEmpty() ) fileName = changeExt( Circuit::self()->getFilePath(), "_"+m_id+".cap" );
+
+    QStringList names;
+    for( int i=0; i<m_numChannels; ++i )
+    {
+        QString name = m_channel[i]->getChName();
+        if( name.isEmpty() ) name = m_analog ? "Ch"+QString::number( i+1 ) : "D"+QString::number( i );
+        names.append( name );
+    }
+    if( !m_dataCapture->start( fileName, m_analog, names ) ) return NULL;
+    return m_dataCapture;
+}
+
+void PlotBase::stopCapture()
+{
+    if( !m_dataCapture->isCapturing() ) return;
+
+    for( int i=0; i<m_numChannels; i++ ) m_channel[i]->m_capture = NULL;
+    m_dataCapture->stop();
+    m_dataCapture->convertAsync( m_timeStep ); // Write VCD or CSV without blocking GUI
+}
+
 void PlotBase::slotProperties()
 {
     Component::slotProperties();
@@ -12,6 +12,7 @@
 
 class IoPin;
 class PlotDisplay;
+class DataCapture;
 class QGraphicsProxyWidget;
 
 class PlotBase : public Component, public ScriptBase
@@ -73,9 +74,21 @@ class PlotBase : public Component, public ScriptBase
         void dump() { dumpData( m_exportFile ); }
         virtual void dumpData( const QString& ){;}
 
+        bool capture() { return m_capture; }
+        void setCapture( bool c ) { m_capture = c; }
+
+        QString captureFile() { return m_captureFile; }
+        void setCaptureFile( QString f ) { m_captureFile = f; }
+
+        DataCapture* startCapture();
+        void stopCapture();
+
         virtual void channelChanged( int ch, QString name ) { m_channel[ch]->m_chTunnel = name; }
 
         PlotDisplay* display() { return m_display; }
+        void publishData();
+        void publishChannel( int ch );
+        void updateDisplay(); // Republish snapshots if Simulation is not running
 
         QColor getColor( int c ) { return m_color[c]; }
 
@@ -119,6 +132,11 @@ class PlotBase : public Component, public ScriptBase
         bool m_autoExport;
         QString m_exportFile;
 
+        bool m_capture;      // Stream samples to file
+        bool m_analog;
+        QString m_captureFile;
+        DataCapture* m_dataCapture;
+
         bool m_connectGnd;
         double m_inputAdmit;
 
@@ -84,6 +84,13 @@ void PlotDisplay::setTimeZero( double t )
     m_timeZero = m_timeZero*100/(double)width();
 }
 
+double PlotDisplay::chanTimeStart( int ch )
+{
+    double timeStart = m_timeStart-m_hPos[ch];
+    if( timeStart < 0 ) timeStart = 0;
+    return timeStart;
+}
+
 void PlotDisplay::updateValues()
 {
     if( m_expand )
@@ -214,14 +221,13 @@ void PlotDisplay::paintEvent( QPaintEvent* /* event */ )
         QPen pen2( m_color[i], 2, Qt::SolidLine, Qt::RoundCap, Qt::RoundJoin );
         p.setPen( pen2 );
 
-        QVector<double>*   voltData = &m_channel[i]->m_buffer;
-        QVector<uint64_t>* timeData = &m_channel[i]->m_time;
+        const double*   voltData = m_channel[i]->m_dispBuffer.constData(); // Snapshot: newest first
+        const uint64_t* timeData = m_channel[i]->m_dispTime.constData();
 
         m_vMaxVal[i] = -1e12;
         m_vMinVal[i] =  1e12;
 
-        int pos = m_channel[i]->m_trigIndex;
-        int bufferSize = m_channel[i]->m_buffer.size();
+        int dataSize = m_channel[i]->m_dispSize;
 
         double timeStart = m_timeStart-m_hPos[i];
         if( timeStart < 0 ) timeStart = 0;
@@ -238,10 +244,10 @@ void PlotDisplay::paintEvent( QPaintEvent* /* event */ )
         double minY  = 1e12;
         bool subSample = false;
 
-        for( int j=0; j<bufferSize; ++j ) // Read Backwards
+        for( int j=0; j<dataSize; ++j ) // Read Backwards
         {
-            p1Volt = voltData->at(pos);
-            time   = timeData->at(pos);
+            p1Volt = voltData[j];
+            time   = timeData[j];
             x1 = m_ceroX + (time+m_hPos[i]-m_timeStart)*m_scaleX;
 
             if( !m_channel[i]->isBus() )
@@ -353,8 +359,6 @@ void PlotDisplay::paintEvent( QPaintEvent* /* event */ )
 
             if( m_channel[i]->isBus() ) lastX = x1;
             else {x2 = x1; y2 = y1;}
-
-            if( --pos < 0 ) pos += bufferSize;
     }   }
     // Draw Rects to crop data plots
     p.fillRect( 0,                   0, m_marginX-1, height(), QColor( 10, 15, 50 ) );
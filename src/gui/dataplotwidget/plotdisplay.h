@@ -42,6 +42,7 @@ class PlotDisplay : public QWidget
 
         uint64_t startTime() { return m_timeStart; }
         uint64_t endTime()   { return m_timeEnd; }
+        double chanTimeStart( int ch ); // Oldest time displayed for this channel
 
         double sizeX() { return m_sizeX; }
 
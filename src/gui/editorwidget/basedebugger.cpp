@@ -53,8 +53,15 @@ bool BaseDebugger::upload()
         m_debugStep = false;
         m_stepOver = false;
         m_running = false;
+        m_lineAddr = -1;
         eMcu::self()->setDebugger( this );
-        if( m_fileExt != ".hex" ) ok = postProcess();
+        if( m_fileExt != ".hex" )
+        {
+            if( m_upToDate && !m_flashToSource.isEmpty() ) // Reuse maps from previous build
+                m_outPane->appendLine( QString::number( m_flashToSource.size() )+" lines mapped" );
+            else ok = postProcess();
+        }
+        mapAddresses();
     }
     return ok;
 }
@@ -208,6 +215,7 @@ bool BaseDebugger::postProcess()
 
 void BaseDebugger::run()
 {
+    setBreakPoints();
     m_running = true;
     stepFromLine();
 }
@@ -216,6 +224,10 @@ void BaseDebugger::pause()
 {
     m_running = false;
     m_debugStep = false;
+    if( m_lineAddr >= 0 ){
+        m_prevLine = m_flashToSource.value( m_lineAddr );
+        m_lineAddr = -1;
+    }
     EditorWindow::self()->pauseAt( m_prevLine );
 }
 
@@ -224,7 +236,7 @@ bool BaseDebugger::stepFromLine( bool over )
     bool ok = true;
     if( m_prevLine.lineNumber == -1 ) // Jump from line 1 to flash addr = 0
     {
-        if( m_flashToSource.keys().contains(0) )
+        if( m_flashToSource.contains(0) )
         {
             codeLine_t l = m_flashToSource.value( 0 );
             m_prevLine = l;
@@ -247,29 +259,72 @@ void BaseDebugger::stepDebug()
     eMcu::self()->stepCpu();
     int PC = eMcu::self()->cpu()->getPC();
 
-    if( lastPC != PC )
+    if( lastPC == PC ) return;
+
+    uint8_t flags = ( (uint32_t)PC < m_addrFlags.size() ) ? m_addrFlags[PC] : 0;
+
+    if( m_over && (flags & ADDR_FUNC) )     // Step Over entry
     {
-        if( m_over ){                                 // Step Over entry
-            if( m_functions.values().contains( PC ) )
-            {
-                m_exitPC = eMcu::self()->cpu()->RET_ADDR();
-                m_over = false;
-                return;
-            }
-        }
-        if( m_exitPC )                               // Step Over exit
-        {
-            if( PC == m_exitPC ) m_exitPC = 0;
-            else return;
-        }
-        if( m_flashToSource.contains( PC ) )
-        {
-            codeLine_t line = m_flashToSource.value( PC );
-            if( line != m_prevLine )
-            {
-                m_prevLine = line;
-                EditorWindow::self()->lineReached( line );
-}   }   }   }
+        m_exitPC = eMcu::self()->cpu()->RET_ADDR();
+        m_over = false;
+        return;
+    }
+    if( m_exitPC )                          // Step Over exit
+    {
+        if( PC == m_exitPC ) m_exitPC = 0;
+        else return;
+    }
+    if( !(flags & ADDR_LINE) ) return;
+
+    if( m_running && !(flags & ADDR_BRK) )  // Running: only lines with breakpoint can stop
+    {
+        m_lineAddr = PC;
+        return;
+    }
+    if( m_lineAddr >= 0 ){
+        m_prevLine = m_flashToSource.value( m_lineAddr );
+        m_lineAddr = -1;
+    }
+    codeLine_t line = m_flashToSource.value( PC );
+    if( line != m_prevLine )
+    {
+        m_prevLine = line;
+        EditorWindow::self()->lineReached( line );
+}   }
+
+void BaseDebugger::mapAddresses()
+{
+    int size = eMcu::self()->flashSize();
+    for( int addr : m_flashToSource.keys() ) if( addr >= size ) size = addr+1;
+    for( int addr : m_functions.values() )   if( addr >= size ) size = addr+1;
+
+    m_addrFlags.assign( size, 0 );
+
+    for( int addr : m_flashToSource.keys() ) if( addr >= 0 ) m_addrFlags[addr] |= ADDR_LINE;
+    for( int addr : m_functions.values() )   if( addr >= 0 ) m_addrFlags[addr] |= ADDR_FUNC;
+}
+
+void BaseDebugger::setBreakPoints()
+{
+    for( uint8_t& flags : m_addrFlags ) flags &= ~ADDR_BRK;
+
+    QHash<int, codeLine_t>::const_iterator it;
+    for( it = m_flashToSource.constBegin(); it != m_flashToSource.constEnd(); ++it )
+    {
+        if( it.key() < 0 ) continue;
+        if( EditorWindow::self()->isBreakPoint( it.value() ) ) m_addrFlags[it.key()] |= ADDR_BRK;
+}   }
+
+void BaseDebugger::setBreakPoint( codeLine_t line, bool brk )
+{
+    QHash<int, codeLine_t>::const_iterator it;
+    for( it = m_flashToSource.constBegin(); it != m_flashToSource.constEnd(); ++it )
+    {
+        if( it.key() < 0 || line != it.value() ) continue;
+        if( (uint32_t)it.key() >= m_addrFlags.size() ) continue;
+        if( brk ) m_addrFlags[it.key()] |=  ADDR_BRK;
+        else      m_addrFlags[it.key()] &= ~ADDR_BRK;
+}   }
 
 QString BaseDebugger::getValue( QString line, QString key ) // Static
 {
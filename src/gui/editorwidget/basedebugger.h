@@ -7,6 +7,7 @@
 #define BASEDEBUGGER_H
 
 #include <QHash>
+#include <vector>
 
 #include "compiler.h"
 
@@ -19,6 +20,12 @@ struct codeLine_t{
     { return lhs.file == file && lhs.lineNumber == lineNumber; }
 };
 
+enum addrFlags_t{      // Per flash address flags used while stepping
+    ADDR_LINE = 1,     // Address mapped to a source line
+    ADDR_FUNC = 1<<1,  // Function entry
+    ADDR_BRK  = 1<<2,  // Source line has a breakpoint
+};
+
 class BaseDebugger : public Compiler    // Base Class for all debuggers
 {
         friend class eMcu;
@@ -42,6 +49,9 @@ class BaseDebugger : public Compiler    // Base Class for all debuggers
         int getValidLine( codeLine_t pc );
         bool isMappedLine( codeLine_t line );
 
+        void setBreakPoints();                          // Rebuild ADDR_BRK flags from Editor breakpoints
+        void setBreakPoint( codeLine_t line, bool brk ); // Update ADDR_BRK flags of one line
+
         QString getVarType( QString var );
 
         static QString getValue( QString line, QString word );
@@ -56,6 +66,8 @@ class BaseDebugger : public Compiler    // Base Class for all debuggers
 
         bool isNoValid( QString line );
 
+        void mapAddresses();   // Build m_addrFlags from source map and functions
+
         virtual void getSubs(){;}
 
         bool m_debugStep;
@@ -65,6 +77,7 @@ class BaseDebugger : public Compiler    // Base Class for all debuggers
         codeLine_t m_prevLine;
 
         int  m_exitPC;
+        int  m_lineAddr;   // Last line address passed while running, -1 if m_prevLine is up to date
         //QList<int>* m_brkPoints;
 
         //int m_lastLine;
@@ -81,6 +94,8 @@ class BaseDebugger : public Compiler    // Base Class for all debuggers
         //QHash<int, int> m_sourceToFlash;        // Map Source code line to flash adress
         QHash<QString, int> m_functions;        // Function name list->start Address
         QList<int>          m_funcAddr;         // Function start Address list
+
+        std::vector<uint8_t> m_addrFlags;       // addrFlags_t by flash address
 };
 
 #endif
@@ -6,6 +6,7 @@
 #include <QPainter>
 #include <QTextDocumentFragment>
 #include <QDomDocument>
+#include <QRegularExpression>
 #include <QDebug>
 
 #include "codeeditor.h"
@@ -142,8 +143,19 @@ QString CodeEditor::compName()
     return "";
 }
 
+bool CodeEditor::isBuilding()
+{
+    if( m_compiler ) return m_compiler->isBuilding();
+    return false;
+}
+
 void CodeEditor::setCompName( QString name )
 {
+    if( isBuilding() )
+    {
+        m_outPane->appendLine( tr("     Build running: can't change Compiler") );
+        return;
+    }
     if( !name .isEmpty() )
     {
         if( m_compiler != NULL )
@@ -319,8 +331,20 @@ void CodeEditor::setFile( QString filePath )
     m_outPane->appendLine( "-------------------------------------------------------" );
 }
 
+static QHash<QString, int> instrSet( QStringList instructions )
+{
+    QHash<QString, int> set;
+    for( QString instruction : instructions ) set[instruction]++;
+    return set;
+}
+
 int CodeEditor::getSyntaxCoincidences()
 {
+    static const QHash<QString, int> picSet = instrSet( m_picInstr ); // Instruction -> times in list
+    static const QHash<QString, int> avrSet = instrSet( m_avrInstr );
+    static const QHash<QString, int> i51Set = instrSet( m_i51Instr );
+    static const QRegularExpression nonWord("\\W+", QRegularExpression::UseUnicodePropertiesOption );
+
     QStringList lines = fileToStringList( m_file, "CodeEditor::getSintaxCoincidences" );
 
     double avr=1, pic=1, i51=1; // Avoid divide by 0
@@ -343,12 +367,15 @@ int CodeEditor::getSyntaxCoincidences()
          || line.startsWith(";")
          || line.startsWith(".") ) continue;
 
-        for( QString instruction : m_avrInstr )
-        { if( line.contains( QRegExp( "\\b"+instruction+"\\b" ) )) {avr++; matches++;} }
-        for( QString instruction : m_picInstr )
-        { if( line.contains( QRegExp( "\\b"+instruction+"\\b" ) )) {pic++; matches++;} }
-        for( QString instruction : m_i51Instr )
-        { if( line.contains( QRegExp( "\\b"+instruction+"\\b" ) )) {i51++; matches++;} }
+        QStringList tokens = line.split( nonWord );
+        tokens.removeAll("");
+        tokens.removeDuplicates();
+        for( QString token : tokens )      // Each instruction counted once per line
+        {
+            int n = avrSet.value( token ); avr += n; matches += n;
+            n = picSet.value( token );     pic += n; matches += n;
+            n = i51Set.value( token );     i51 += n; matches += n;
+        }
         if( matches > 200 || ++nlines > 400 ) break;
     }
     if( matches == 0 ) return 0;
@@ -401,6 +428,8 @@ void CodeEditor::addBreakPoint( int line )
         //block.setUserData( data );
 
         m_brkPoints.append( line );
+        if( EditorWindow::self()->debugState() > DBG_STOPPED )
+            EditorWindow::self()->debugger()->setBreakPoint( {m_file, line}, true );
         update();
     }
 }
@@ -408,12 +437,22 @@ void CodeEditor::addBreakPoint( int line )
 void CodeEditor::remBreakPoint( int line )
 {
     m_brkPoints.removeOne( line );
+    if( EditorWindow::self()->debugState() > DBG_STOPPED )
+        EditorWindow::self()->debugger()->setBreakPoint( {m_file, line}, false );
     //QTextBlock block = document()->findBlockByNumber( line-1 );
     //UserData* data = (UserData*)block.userData();
     //data->breakp = false;
     update();
 }
 
+void CodeEditor::slotClearBreak()
+{
+    m_brkPoints.clear();
+    if( EditorWindow::self()->debugState() > DBG_STOPPED )
+        EditorWindow::self()->debugger()->setBreakPoints();
+    update();
+}
+
 void CodeEditor::startDebug()
 {
     setReadOnly( true );
@@ -631,6 +670,19 @@ void CodeEditor::updateLineNumberArea( const QRect &rect, int dy )
     if( dy ) m_lNumArea->scroll( 0, dy );
     else     m_lNumArea->update( 0, rect.y(), m_lNumArea->width(), rect.height() );
     if( rect.contains( viewport()->rect() ) ) updateLineNumberAreaWidth( 0 );
+
+    QTextBlock block = firstVisibleBlock();
+    int first = block.blockNumber();
+    int last  = first;
+    int top = (int)blockBoundingGeometry( block ).translated( contentOffset() ).top();
+    int height = viewport()->height();
+    while( block.isValid() && top <= height )
+    {
+        last = block.blockNumber();
+        top += (int)blockBoundingRect( block ).height();
+        block = block.next();
+    }
+    m_hlighter->setVisibleBlocks( first, last );
 }
 
 void CodeEditor::resizeEvent( QResizeEvent* e )
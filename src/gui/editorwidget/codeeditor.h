@@ -77,6 +77,7 @@ class CodeEditor : public QPlainTextEdit, public CompBase
         int  lineNumberAreaWidth();
 
         BaseDebugger* getCompiler() { return m_compiler; }
+        bool isBuilding();   // Compiler must not be deleted while building
         //void setCompiler( BaseDebugger* comp );
 
         void fileProps();
@@ -95,7 +96,7 @@ class CodeEditor : public QPlainTextEdit, public CompBase
     public slots:
         void slotAddBreak() { m_brkAction = 1; }
         void slotRemBreak() { m_brkAction = 2; }
-        void slotClearBreak() { m_brkPoints.clear(); }
+        void slotClearBreak();
 
     private slots:
         void updateLineNumberAreaWidth(int) { setViewportMargins( lineNumberAreaWidth(), 0, 0, 0 ); }
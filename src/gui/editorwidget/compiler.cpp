@@ -4,10 +4,13 @@
  ***( see copyright.txt file at root folder )*******************************/
 
 #include <QRegularExpression>
+#include <QCryptographicHash>
+#include <QEventLoop>
 #include <QDomDocument>
 #include <QFileDialog>
 #include <QSettings>
 #include <QDir>
+#include <QDirIterator>
 
 #include "compiler.h"
 #include "simulator.h"
@@ -19,6 +22,8 @@
 
 #include "stringprop.h"
 
+#define maxHashFiles 5000 // More files in source/include folders: dependencies unknown, always build
+
 Compiler::Compiler( CodeEditor* editor, OutPanelText* outPane )
         : QObject( editor )
         , CompBase( "Compiler", "" )
@@ -34,9 +39,14 @@ Compiler::Compiler( CodeEditor* editor, OutPanelText* outPane )
     m_firmware = "";
     m_buildPath = m_fileDir;
     m_fileProps = false;
+    m_building  = false;
+    m_upToDate  = false;
 
     clearCompiler();
 
+    connect( &m_compProcess, &QProcess::readyReadStandardOutput, [=](){ readOutput(); } );
+    connect( &m_compProcess, &QProcess::readyReadStandardError,  [=](){ readOutput(); } );
+
     addPropGroup( { "Hidden", {
         new StrProp<Compiler>("itemtype","" ,""
                              , this, &Compiler::itemType, &Compiler::setItemType ),
@@ -180,15 +190,21 @@ void Compiler::addFilePropHead()
 
 int Compiler::compile( bool debug )
 {
+    if( m_building )
+    {
+        m_outPane->appendLine( tr("     Build already running") );
+        return -1;
+    }
     if     ( m_compName == "None" ) m_outPane->appendLine( tr("     No Compiler Defined") );
     else if( m_command.isEmpty() )  m_outPane->appendLine( tr("     No command Defined") );
 
     int error = 0;
-    QApplication::setOverrideCursor( Qt::WaitCursor );
+    m_upToDate = false;
 
     m_fileList.clear();
     preProcess();
 
+    QStringList commands;
     for( int i=0; i<m_command.size(); ++i )
     {
         QString command = m_toolPath + m_command.at(i);
@@ -224,12 +240,30 @@ int Compiler::compile( bool debug )
             }
             else arguments = arguments.replace( "$device", m_device );
         }
-        error = runBuildStep( command + arguments );
+        commands.append( command + arguments );
+    }
+    if( error ) return error;
+
+    QString firmware = m_buildPath+m_fileName+".hex";
+    QByteArray hash;
+    if( !commands.isEmpty() )
+    {
+        hash = buildHash( commands, {m_fileDir, m_inclPath} );
+        if( upToDate( hash, firmware ) ) { compiled( firmware ); return 0; }
+    }
+    m_building = true;
+    for( QString command : commands )
+    {
+        error = runBuildStep( command );
         if( error > 0 ) break;
     }
-    if( error == 0 ) compiled( m_buildPath+m_fileName+".hex" );
+    m_building = false;
 
-    QApplication::restoreOverrideCursor();
+    if( error == 0 ){
+        postBuild();
+        compiled( firmware );
+        setBuilt( hash, firmware );
+    }
     return error;
 }
 
@@ -237,12 +271,101 @@ int Compiler::runBuildStep( QString fullCommand )
 {
     m_outPane->appendLine( "Executing:\n"+fullCommand+"\n" );
     m_compProcess.setWorkingDirectory( m_fileDir );
-    m_compProcess.start( fullCommand  );
-    m_compProcess.waitForFinished(-1);
+    runProcess( fullCommand );
 
     return getErrors();
 }
 
+void Compiler::runProcess( QString command ) // Local event loop: GUI updates and Simulation keep running
+{
+    m_stdOut.clear();
+    m_stdErr.clear();
+
+    QEventLoop loop;
+    connect( &m_compProcess, SIGNAL(finished(int,QProcess::ExitStatus)), &loop, SLOT(quit()) );
+
+    m_compProcess.start( command );
+    // No user input until build finishes: circuit, simulation and editors must not change meanwhile
+    if( m_compProcess.waitForStarted() && m_compProcess.state() == QProcess::Running )
+        loop.exec( QEventLoop::ExcludeUserInputEvents );
+    readOutput();
+}
+
+void Compiler::readOutput() // Stream build output to OutPanel and keep it for getErrors()
+{
+    if( !m_building ) return; // Other processes read their own output
+
+    QString out = m_compProcess.readAllStandardOutput();
+    QString err = m_compProcess.readAllStandardError();
+    if( out.isEmpty() && err.isEmpty() ) return;
+
+    m_stdOut.append( out );
+    m_stdErr.append( err );
+
+    m_outPane->appendText( out+err );
+    if( !Simulator::self()->isRunning() ) m_outPane->updateStep();
+}
+
+QByteArray Compiler::buildHash( QStringList commands, QStringList dirs ) // Compiler + arguments + build inputs
+{
+    QCryptographicHash hash( QCryptographicHash::Sha1 );
+    hash.addData( m_compName.toUtf8() );
+    hash.addData( commands.join("\n").toUtf8() );
+
+    QStringList files = m_fileList;
+    if( !files.contains( m_file ) ) files.prepend( m_file );
+
+    for( QString fileName : files )         // Project files: content
+    {
+        QFile file( fileName );
+        if( !file.open( QIODevice::ReadOnly ) ) return QByteArray(); // Always build
+        hash.addData( fileName.toUtf8() );
+        hash.addData( &file );
+    }
+    QString buildDir;
+    if( !m_buildPath.isEmpty() ) buildDir = QDir( m_buildPath ).absolutePath()+"/";
+    int numFiles = 0;
+
+    for( QString dir : dirs )   // Anything that can be included (.inc, .ino tabs, libraries): size and time
+    {
+        if( dir.isEmpty() ) continue;
+        QDirIterator it( dir, QDir::Files, QDirIterator::Subdirectories );
+        while( it.hasNext() )
+        {
+            it.next();
+            QFileInfo fi = it.fileInfo();
+            if( !buildDir.isEmpty() && fi.absoluteFilePath().startsWith( buildDir ) ) continue; // Build output
+            if( ++numFiles > maxHashFiles ) return QByteArray();
+
+            hash.addData( fi.absoluteFilePath().toUtf8() );
+            hash.addData( QByteArray::number( fi.size() ) );
+            hash.addData( QByteArray::number( fi.lastModified().toMSecsSinceEpoch() ) );
+    }   }
+    return hash.result();
+}
+
+bool Compiler::upToDate( QByteArray hash, QString firmware )
+{
+    if( hash.isEmpty() || hash != m_buildHash ) return false;
+
+    QFileInfo fi( firmware );     // Firmware deleted or rebuilt outside
+    if( !fi.exists() || fi.lastModified() != m_hexTime ) return false;
+
+    m_outPane->appendLine( tr("     Sources not changed: using previous build")+"\n" );
+    m_upToDate = true;
+    return true;
+}
+
+void Compiler::setBuilt( QByteArray hash, QString firmware )
+{
+    QFileInfo fi( firmware );
+    if( fi.exists() ){
+        m_buildHash = hash;
+        m_hexTime = fi.lastModified();
+    }
+    else m_buildHash.clear();
+}
+
 void Compiler::compiled( QString firmware )
 {
     //m_fileList.clear();
@@ -256,19 +379,15 @@ int Compiler::getErrors()
 {
     int error = 0;
 
-    QString p_stdout = m_compProcess.readAllStandardOutput();
-    if( !p_stdout.isEmpty() ) error = getErrorLine( p_stdout );
+    if( !m_stdOut.isEmpty() ) error = getErrorLine( m_stdOut );
     if( error ) return error;
 
-    QString p_stderr = m_compProcess.readAllStandardError();
-    if( !p_stderr.isEmpty() ) error = getErrorLine( p_stderr );
+    if( !m_stdErr.isEmpty() ) error = getErrorLine( m_stdErr );
     return error;
 }
 
-int Compiler::getErrorLine( QString txt )
+int Compiler::getErrorLine( QString txt ) // Output already streamed to OutPanel
 {
-    m_outPane->appendLine( txt );
-
     int error = 0;
     for( QString line : txt.split("\n") )
     {
@@ -8,6 +8,7 @@
 
 #include <QString>
 #include <QProcess>
+#include <QDateTime>
 
 #include "compbase.h"
 
@@ -58,10 +59,13 @@ class Compiler : public QObject, public CompBase
 
         OutPanelText* outPane() { return m_outPane; }
 
+        bool isBuilding() { return m_building; }
+
     protected:
         void addFilePropHead();
 
         virtual void preProcess(){;}
+        virtual void postBuild(){;}  // Build steps succeeded: finish firmware file
         virtual bool postProcess(){return false;}
 
         int getErrors();
@@ -70,6 +74,13 @@ class Compiler : public QObject, public CompBase
         void compiled( QString firmware );
 
         int runBuildStep( QString fullCommand );
+        void runProcess( QString command );
+        void readOutput();
+
+        QByteArray buildHash( QStringList commands, QStringList dirs );
+        bool upToDate( QByteArray hash, QString firmware );
+        void setBuilt( QByteArray hash, QString firmware );
+
         QString replaceData( QString str );
         void toolChainNotFound();
 
@@ -77,6 +88,8 @@ class Compiler : public QObject, public CompBase
 
         bool m_uploadHex;
         bool m_fileProps;
+        bool m_building; // Toolchain running
+        bool m_upToDate; // Last compile skipped: sources, compiler and arguments not changed
 
         QString m_compName;
         QString m_toolPath;
@@ -98,6 +111,11 @@ class Compiler : public QObject, public CompBase
         QString m_fileExt;
 
         QProcess m_compProcess;
+        QString  m_stdOut;   // Output of last build step
+        QString  m_stdErr;
+
+        QByteArray m_buildHash; // Hash of last successful build
+        QDateTime  m_hexTime;   // Firmware file time at last successful build
 
         OutPanelText* m_outPane;
 };
@@ -8,6 +8,8 @@
 
 #include "cdebugger.h"
 
+class ElfReader;
+
 class AvrGccDebugger : public cDebugger
 {
     public:
@@ -17,9 +19,9 @@ class AvrGccDebugger : public cDebugger
     protected:
         virtual bool postProcess() override;
 
-        bool getVariables();
-        bool getFunctions();
-        bool mapFlashToSource();
+        bool getVariables( ElfReader* elf );
+        bool getFunctions( ElfReader* elf );
+        bool mapFlashToSource( ElfReader* elf );
 
         int m_addrBytes;
 
@@ -26,8 +26,6 @@ GcbDebugger::~GcbDebugger(){}
 
 int GcbDebugger::getErrorLine( QString txt )
 {
-    m_outPane->appendLine( txt );
-
     int error = 0;
     if( m_compProcess.exitCode() )
     {
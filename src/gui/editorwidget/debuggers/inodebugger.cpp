@@ -147,29 +147,21 @@ bool InoDebugger::upload() // Copy hex file to Circuit folder, then upload
 int InoDebugger::compile( bool debug )
 {
     if( m_version == 0 ) { toolChainNotFound(); return -1; }
-    QApplication::setOverrideCursor(Qt::WaitCursor);
+    if( m_building )
+    {
+        m_outPane->appendLine( tr("     Build already running") );
+        return -1;
+    }
+    m_upToDate = false;
 
     m_fileList.clear();
     m_fileList.append( m_file );
     preProcess();
 
-    QString cBuildPath = m_buildPath+"/build";
-    QString cCachePath = m_buildPath+"/cache";
-
-    QDir dir( m_buildPath );
-    bool b = dir.cd( "build" );
-    if( b ) dir.removeRecursively();   // Remove old files
-    dir.mkpath( cBuildPath );  // Create build folder
-    dir.mkpath( cCachePath );  // Create cache folder ( if doesn't exist )
-
-    if( !QFile::exists( cBuildPath ) || !QFile::exists( cCachePath ) )
-    {
-        m_outPane->appendLine( "\n    ERROR: Build folders NOT found at:\n    "+m_buildPath );
-        QApplication::restoreOverrideCursor();
-        return -1;
-    }
-    cBuildPath = addQuotes( cBuildPath );
-    cCachePath = addQuotes( cCachePath );
+    QString buildPath  = m_buildPath+"/build";
+    QString cachePath  = m_buildPath+"/cache";
+    QString cBuildPath = addQuotes( buildPath );
+    QString cCachePath = addQuotes( cachePath );
 
     QString boardSource;
     QString boardName = m_board.toLower();
@@ -229,11 +221,31 @@ int InoDebugger::compile( bool debug )
             command += " --libraries "+addQuotes( m_inclPath );
     }
     command += " "+addQuotes( m_file );
+
+    QString firmware = m_buildPath+"/build/"+m_fileName+".ino.hex";
+    QString userLibs = m_inclPath;
+    if( userLibs.isEmpty() && !m_sketchBook.isEmpty() ) userLibs = m_sketchBook+"/libraries";
+
+    QByteArray hash = buildHash( {command}, {m_fileDir, userLibs} );
+    if( upToDate( hash, firmware ) ) { compiled( firmware ); return 0; }
+
     m_firmware = "";
 
+    QDir dir( m_buildPath );
+    bool b = dir.cd( "build" );
+    if( b ) dir.removeRecursively();   // Remove old files
+    dir.mkpath( buildPath );  // Create build folder
+    dir.mkpath( cachePath );  // Create cache folder ( if doesn't exist )
+
+    if( !QFile::exists( buildPath ) || !QFile::exists( cachePath ) )
+    {
+        m_outPane->appendLine( "\n    ERROR: Build folders NOT found at:\n    "+m_buildPath );
+        return -1;
+    }
     m_outPane->appendLine( "\nExecuting:\n"+command+"\n" );
-    m_compProcess.start( command );
-    m_compProcess.waitForFinished(-1);
+    m_building = true;
+    runProcess( command );
+    m_building = false;
 
     m_outPane->appendLine( "Build folder: "+m_buildPath );
     m_outPane->appendLine( "SketchBook:   "+m_sketchBook );
@@ -241,9 +253,10 @@ int InoDebugger::compile( bool debug )
     m_outPane->appendLine( "" );
 
     int error = getErrors();
-    if( error == 0 ) compiled( m_buildPath+"/build/"+m_fileName+".ino.hex");
-
-    QApplication::restoreOverrideCursor();
+    if( error == 0 ){
+        compiled( firmware );
+        setBuilt( hash, firmware );
+    }
     return error;
 }
 
@@ -21,34 +21,31 @@ SdccDebugger::SdccDebugger( CodeEditor* parent, OutPanelText* outPane )
 }
 SdccDebugger::~SdccDebugger(){}
 
-int SdccDebugger::compile( bool debug )
+void SdccDebugger::postBuild() // Pack ihx to hex before the build is recorded
 {
-    int error = Compiler::compile( debug );
-    if( error == 0 && !m_family.startsWith("pic") )
-    {
-        QFileInfo ihxInfo(m_buildPath+m_fileName+".ihx");
-        QFileInfo hexInfo(m_buildPath+m_fileName+".hex");
+    if( m_family.startsWith("pic") ) return;
+
+    QFileInfo ihxInfo(m_buildPath+m_fileName+".ihx");
+    QFileInfo hexInfo(m_buildPath+m_fileName+".hex");
 
-        if( !hexInfo.exists() // hex file not exists
-         || ( ihxInfo.exists() && (hexInfo.lastModified() < ihxInfo.lastModified()))) // ihx file is newer
+    if( !hexInfo.exists() // hex file not exists
+     || ( ihxInfo.exists() && (hexInfo.lastModified() < ihxInfo.lastModified()))) // ihx file is newer
+    {
+        QString packihx = m_toolPath+"packihx";
+    #ifndef Q_OS_UNIX
+        packihx += ".exe";
+    #endif
+        m_compProcess.setWorkingDirectory( m_buildPath );
+        m_compProcess.start( packihx+" "+m_fileName+".ihx" );
+        m_compProcess.waitForFinished(-1);
+
+        QFile file( m_buildPath+m_fileName+".hex" );
+        if( file.open(QFile::WriteOnly | QFile::Text | QFile::Truncate) )
         {
-            QString packihx = m_toolPath+"packihx";
-        #ifndef Q_OS_UNIX
-            packihx += ".exe";
-        #endif
-            m_compProcess.setWorkingDirectory( m_buildPath );
-            m_compProcess.start( packihx+" "+m_fileName+".ihx" );
-            m_compProcess.waitForFinished(-1);
-
-            QFile file( m_buildPath+m_fileName+".hex" );
-            if( file.open(QFile::WriteOnly | QFile::Text | QFile::Truncate) )
-            {
-                QTextStream out(&file);
-                out << m_compProcess.readAllStandardOutput();
-                file.close();
-    }   }   }
-    return error;
-}
+            QTextStream out(&file);
+            out << m_compProcess.readAllStandardOutput();
+            file.close();
+}   }   }
 
 bool SdccDebugger::postProcess()
 {
@@ -14,10 +14,9 @@ class SdccDebugger : public cDebugger
         SdccDebugger( CodeEditor* parent, OutPanelText* outPane );
         ~SdccDebugger();
 
-        virtual int compile( bool debug ) override;
-
     protected:
         virtual bool postProcess() override;
+        virtual void postBuild() override;
 
         bool findCSEG();
 };
@@ -123,6 +123,12 @@ QList<CodeEditor*> EditorWidget::getCodeEditors()
 
 bool EditorWidget::close()
 {
+    for( CodeEditor* ce : getCodeEditors() )
+    {
+        if( !ce->isBuilding() ) continue;
+        m_outPane.appendLine( tr("     Build running: wait until it finishes") );
+        return false;
+    }
     int count = m_docWidget->count();
     for( int i=0; i<count; i++ )
     {
@@ -301,6 +307,11 @@ bool EditorWidget::save()
 bool EditorWidget::saveAs()
 {
     CodeEditor* ce = getCodeEditor();
+    if( ce->isBuilding() )  // setFile() recreates the Compiler
+    {
+        m_outPane.appendLine( tr("     Build running: wait until it finishes") );
+        return false;
+    }
 
     QFileInfo fi = QFileInfo( ce->getFile() );
     QString ext  = fi.suffix();
@@ -399,6 +410,11 @@ void EditorWidget::updateDoc( int )
 
 void EditorWidget::closeTab( int index )
 {
+    if( ((CodeEditor*)m_docWidget->widget( index ))->isBuilding() )
+    {
+        m_outPane.appendLine( tr("     Build running: wait until it finishes") );
+        return;
+    }
     if( m_debuggerToolBar->isVisible() ) stop();
 
     m_docWidget->setCurrentIndex( index );
@@ -200,18 +200,17 @@ void EditorWindow::stepDebug( bool over )
 
 void EditorWindow::lineReached( codeLine_t line ) // Processor reached PC related to source line
 {
-    if( m_state == DBG_RUNNING ) // Check if there is a breakpoint
-    {
-        if( m_fileList.contains( line.file ) )
-        {
-            CodeEditor* ce = (CodeEditor*)m_fileList.value( line.file );
-            if( ce && !ce->getBreakPoints()->contains( line.lineNumber ) ) return;
-        }
-        else return;
-    }
+    if( m_state == DBG_RUNNING && !isBreakPoint( line ) ) return;
     pause();
 }
 
+bool EditorWindow::isBreakPoint( codeLine_t line )
+{
+    CodeEditor* ce = (CodeEditor*)m_fileList.value( line.file );
+    if( !ce ) return false;
+    return ce->getBreakPoints()->contains( line.lineNumber );
+}
+
 void EditorWindow::pauseAt( codeLine_t line )
 {
     m_debugLine = line;
@@ -42,6 +42,7 @@ class EditorWindow : public EditorWidget, public Updatable
         bool debugStarted() { return (m_state > DBG_STOPPED); }
         void lineReached( codeLine_t line );
         void pauseAt( codeLine_t line );
+        bool isBreakPoint( codeLine_t line );
 
         bebugState_t debugState() { return m_state; }
 
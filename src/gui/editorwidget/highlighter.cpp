@@ -13,6 +13,8 @@ Highlighter::Highlighter( QTextDocument* parent )
            : QSyntaxHighlighter( parent )
 { 
     m_multiline = false;
+    m_firstVisible = 0;
+    m_lastVisible = -1;
 }
 Highlighter::~Highlighter(){}
 
@@ -25,6 +27,7 @@ void Highlighter::readSyntaxFile( QString fileName )
     fileName = path+fileName;
 
     m_rules.clear();
+    m_multiline = false;
 
     QTextCharFormat format;
 
@@ -90,12 +93,14 @@ void Highlighter::readSyntaxFile( QString fileName )
                         m_multiEnd.setPattern( exp.replace("\\\\","\\")  );
                 }   }
                 else{
+                    QStringList wordList;
                     for( QString exp : words )
                     {
-                        if( exp.startsWith("\"")) exp = remQuotes( exp ); // RegExp
-                        else                      exp = "\\b"+exp+"\\b";
-                        addRule( format, exp );
-                }   }
+                        if( exp.startsWith("\"")) addRule( format, remQuotes( exp ) ); // RegExp
+                        else                      wordList.append( exp );
+                    }
+                    addWords( format, wordList ); // All words in one expression
+                }
                 format.setFontWeight( QFont::Normal );         // Reset to Defaults
                 format.setForeground( Qt::black );             // Reset to Defaults
             }
@@ -105,7 +110,7 @@ void Highlighter::readSyntaxFile( QString fileName )
     addRule( format, QString( " " ) );
     addRule( format, QString( "\t" ) );
     
-    this->rehighlight();
+    rehighlight();
 }
 
 void Highlighter::addRegisters( QStringList patterns )
@@ -114,55 +119,88 @@ void Highlighter::addRegisters( QStringList patterns )
     format.setFontWeight( QFont::Bold );
     format.setForeground( QColor( 55, 65, 20 ) );
     
-    for( QString exp : patterns ) addRule( format, "\\b"+exp+"\\b" );
-    this->rehighlight();
+    addWords( format, patterns );
+    rehighlight();
 }
 
+void Highlighter::setVisibleBlocks( int first, int last )
+{
+    m_firstVisible = first;
+    m_lastVisible  = last;
+
+    QTextDocument* doc = document();
+    if( !doc || ( m_rules.isEmpty() && !m_multiline ) ) return;
+
+    QTextBlock block = doc->findBlockByNumber( first );
+    while( block.isValid() && block.blockNumber() <= last ) // Apply rules to blocks scrolled into view
+    {
+        HighlightData* data = static_cast<HighlightData*>( block.userData() );
+        if( !data || !data->highlighted ) rehighlightBlock( block );
+        block = block.next();
+}   }
+
 void Highlighter::highlightBlock( const QString &text )
 {
-    QString lcText = text;
-    lcText = lcText.toLower(); // Do case insensitive
+    if( m_rules.isEmpty() && !m_multiline ) return;
+
+    int blockNum = currentBlock().blockNumber();
+    bool visible = blockNum >= m_firstVisible && blockNum <= m_lastVisible;
 
-    for( const HighlightRule &rule : m_rules ) processRule( rule, lcText );
+    HighlightData* data = static_cast<HighlightData*>( currentBlockUserData() );
+    if( !data ){
+        data = new HighlightData();
+        setCurrentBlockUserData( data );
+    }
+    data->highlighted = visible;
+
+    if( visible )                 // Hidden blocks only keep multiline state
+    {
+        QString lcText = text.toLower(); // Do case insensitive
+        for( const HighlightRule &rule : m_rules ) processRule( rule, lcText );
+    }
 
     if( m_multiline )                              // Multiline comment:
     {
         setCurrentBlockState( 0 );
         int startIndex = 0;
         if( previousBlockState() != -10 )
-            startIndex = m_multiStart.indexIn( text );
+            startIndex = m_multiStart.match( text ).capturedStart();
 
         while( startIndex >= 0 )
         {
-            int endIndex = m_multiEnd.indexIn( text, startIndex );
+            QRegularExpressionMatch end = m_multiEnd.match( text, startIndex );
             int commentLength;
-            if( endIndex == -1 )
+            if( !end.hasMatch() )
             {
                 setCurrentBlockState( -10 );
                 commentLength = text.length()- startIndex;
             }else{
-                commentLength = endIndex - startIndex + m_multiEnd.matchedLength();
+                commentLength = end.capturedEnd() - startIndex;
             }
             setFormat( startIndex, commentLength, m_multiFormat );
-            startIndex = m_multiStart.indexIn( text, startIndex + commentLength );
+            startIndex = m_multiStart.match( text, startIndex + commentLength ).capturedStart();
 }   }   }
 
-void Highlighter::processRule( HighlightRule rule, QString lcText )
+void Highlighter::processRule( const HighlightRule& rule, const QString& lcText )
 {
-    QRegExp expression( rule.pattern );
-    int index = expression.indexIn( lcText );
-    while( index >= 0 )
+    QRegularExpressionMatchIterator it = rule.pattern.globalMatch( lcText );
+    while( it.hasNext() )
     {
-        int length = expression.matchedLength();
-        setFormat( index, length, rule.format );
-        index = expression.indexIn( lcText, index + length );
+        QRegularExpressionMatch match = it.next();
+        setFormat( match.capturedStart(), match.capturedLength(), rule.format );
 }   }
 
 void Highlighter::addRule( QTextCharFormat format, QString exp )
 {
     HighlightRule rule;
 
-    rule.pattern = QRegExp( exp );
+    rule.pattern = QRegularExpression( exp );
     rule.format = format;
     m_rules.append(rule);
 }
+
+void Highlighter::addWords( QTextCharFormat format, QStringList words )
+{
+    if( words.isEmpty() ) return;
+    addRule( format, "\\b(?:"+words.join("|")+")\\b" );
+}
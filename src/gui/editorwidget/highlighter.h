@@ -8,6 +8,7 @@
 
 #include <QSyntaxHighlighter>
 #include <QTextCharFormat>
+#include <QRegularExpression>
 
 class QTextDocument;
 
@@ -23,24 +24,36 @@ class Highlighter : public QSyntaxHighlighter
 
         void addRegisters( QStringList patterns );
 
+        void setVisibleBlocks( int first, int last );
+
     protected:
         void highlightBlock( const QString &text );
 
     private:
         struct HighlightRule
         {
-            QRegExp pattern;
+            QRegularExpression pattern; // Compiled once
             QTextCharFormat format;
         };
         void addRule( QTextCharFormat, QString );
-        void processRule( HighlightRule rule, QString lcText );
+        void addWords( QTextCharFormat format, QStringList words );
+        void processRule( const HighlightRule& rule, const QString& lcText );
+
+        class HighlightData : public QTextBlockUserData
+        {
+            public:
+                bool highlighted; // Rules applied, not only multiline state
+        };
 
         bool m_multiline;
+
+        int m_firstVisible;  // Rules are only applied to visible blocks
+        int m_lastVisible;
         
         QVector<HighlightRule> m_rules;
 
-        QRegExp m_multiStart;
-        QRegExp m_multiEnd;
+        QRegularExpression m_multiStart;
+        QRegularExpression m_multiEnd;
         QTextCharFormat m_multiFormat;
 };
 
@@ -0,0 +1,445 @@
+/***************************************************************************
+ *   Copyright (C) 2023 by Santiago González                               *
+ *                                                                         *
+ ***( see copyright.txt file at root folder )*******************************/
+
+#include <QFile>
+#include <QDir>
+#include <QDebug>
+
+#include "elfreader.h"
+#include "utils.h"
+
+#define PT_LOAD      1
+#define SHT_PROGBITS 1
+#define SHT_SYMTAB   2
+
+// DWARF Line Number Program
+#define DW_LNS_copy             1
+#define DW_LNS_advance_pc       2
+#define DW_LNS_advance_line     3
+#define DW_LNS_set_file         4
+#define DW_LNS_set_column       5
+#define DW_LNS_negate_stmt      6
+#define DW_LNS_set_basic_block  7
+#define DW_LNS_const_add_pc     8
+#define DW_LNS_fixed_advance_pc 9
+#define DW_LNS_set_prologue_end 10
+#define DW_LNS_set_epilogue_beg 11
+#define DW_LNS_set_isa          12
+
+#define DW_LNE_end_sequence 1
+#define DW_LNE_set_address  2
+#define DW_LNE_define_file  3
+
+#define DW_LNCT_path            1
+#define DW_LNCT_directory_index 2
+
+#define DW_FORM_data2     0x05
+#define DW_FORM_data4     0x06
+#define DW_FORM_data8     0x07
+#define DW_FORM_string    0x08
+#define DW_FORM_block     0x09
+#define DW_FORM_data1     0x0b
+#define DW_FORM_strp      0x0e
+#define DW_FORM_udata     0x0f
+#define DW_FORM_data16    0x1e
+#define DW_FORM_line_strp 0x1f
+
+ElfReader::ElfReader()
+{
+    m_bigEndian = false;
+    m_machine = 0;
+}
+
+bool ElfReader::isElf( QString fileName )
+{
+    QFile file( fileName );
+    if( !file.open( QIODevice::ReadOnly ) ) return false;
+    return file.read( 4 ) == "\x7F""ELF";
+}
+
+bool ElfReader::open( QString fileName )
+{
+    m_sections.clear();
+    m_files.clear();
+
+    m_data = fileToByteArray( fileName, "ElfReader::open" );
+    if( m_data.size() < 52 || !m_data.startsWith("\x7F""ELF") )
+    {
+        qDebug() << "ElfReader::open Error: Not an ELF file" << fileName;
+        return false;
+    }
+    if( m_data.at( 4 ) != 1 )
+    {
+        qDebug() << "ElfReader::open Error: Only 32 bits ELF supported" << fileName;
+        return false;
+    }
+    m_bigEndian = m_data.at( 5 ) == 2;
+    m_machine   = readU16( 18 );
+
+    uint32_t shoff  = readU32( 32 );
+    uint16_t shsize = readU16( 46 );
+    uint16_t shnum  = readU16( 48 );
+    uint16_t strndx = readU16( 50 );
+
+    QList<uint32_t> nameOffsets;
+    for( int i=0; i<shnum; ++i )
+    {
+        uint32_t sh = shoff+i*shsize;
+        section_t section;
+        section.type   = readU32( sh+4 );
+        section.addr   = readU32( sh+12 );
+        section.offset = readU32( sh+16 );
+        section.size   = readU32( sh+20 );
+        section.link   = readU32( sh+24 );
+        m_sections.append( section );
+        nameOffsets.append( readU32( sh ) );
+    }
+    if( strndx < m_sections.size() )
+    {
+        uint32_t strTab = m_sections.at( strndx ).offset;
+        for( int i=0; i<m_sections.size(); ++i )
+        {
+            uint32_t pos = strTab+nameOffsets.at( i );
+            m_sections[i].name = readStr( &pos );
+    }   }
+    return true;
+}
+
+QList<ElfReader::segment_t> ElfReader::segments()
+{
+    QList<segment_t> segments;
+
+    uint32_t phoff  = readU32( 28 );
+    uint16_t phsize = readU16( 42 );
+    uint16_t phnum  = readU16( 44 );
+
+    for( int i=0; i<phnum; ++i )
+    {
+        uint32_t ph = phoff+i*phsize;
+        if( readU32( ph ) != PT_LOAD ) continue;
+
+        uint32_t offset = readU32( ph+4 );
+        uint32_t paddr  = readU32( ph+12 ); // Load address: initialized data is stored in Flash
+        uint32_t filesz = readU32( ph+16 );
+        if( !filesz || offset+filesz > (uint32_t)m_data.size() ) continue;
+
+        segments.append( { paddr, m_data.mid( offset, filesz ) } );
+    }
+    if( segments.isEmpty() )    // No program headers: use allocated sections
+    {
+        for( section_t sec : m_sections )
+        {
+            if( sec.type != SHT_PROGBITS || !sec.size ) continue;
+            if( sec.offset+sec.size > (uint32_t)m_data.size() ) continue;
+            segments.append( { sec.addr, m_data.mid( sec.offset, sec.size ) } );
+    }   }
+    return segments;
+}
+
+QList<ElfReader::symbol_t> ElfReader::symbols()
+{
+    QList<symbol_t> symbols;
+
+    for( section_t sec : m_sections )
+    {
+        if( sec.type != SHT_SYMTAB || (int)sec.link >= m_sections.size() ) continue;
+        uint32_t strTab = m_sections.at( sec.link ).offset;
+        uint32_t end = qMin( sec.offset+sec.size, (uint32_t)m_data.size() );
+
+        for( uint32_t st=sec.offset; st+16<=end; st+=16 )
+        {
+            int type = byte( st+12 ) & 0x0F;
+            if( type != ELF_SYM_OBJECT && type != ELF_SYM_FUNC ) continue;
+
+            uint32_t pos = strTab+readU32( st );
+            uint16_t index = readU16( st+14 );
+
+            symbol_t symbol;
+            symbol.name    = readStr( &pos );
+            symbol.section = index < m_sections.size() ? m_sections.at( index ).name : "";
+            symbol.value   = readU32( st+4 );
+            symbol.size    = readU32( st+8 );
+            symbol.type    = type;
+            symbols.append( symbol );
+    }   }
+    return symbols;
+}
+
+QList<ElfReader::lineRow_t> ElfReader::lineTable()
+{
+    QList<lineRow_t> rows;
+    m_files.clear();
+
+    const section_t* lines = section(".debug_line");
+    if( !lines ) return rows;
+
+    uint32_t pos = lines->offset;
+    uint32_t end = qMin( lines->offset+lines->size, (uint32_t)m_data.size() );
+
+    while( pos+4 <= end )            // One unit per compilation unit
+    {
+        uint64_t length = readU32( pos );
+        pos += 4;
+        bool dwarf64 = false;
+        if( length == 0xFFFFFFFF ){
+            length = readU( pos, 8 );
+            pos += 8;
+            dwarf64 = true;
+        }
+        else if( length >= 0xFFFFFFF0 ) break;
+
+        if( pos+length > end ) break;
+        uint32_t unitEnd = pos+length;
+        parseLineUnit( pos, unitEnd, dwarf64, &rows );
+        pos = unitEnd;
+    }
+    return rows;
+}
+
+void ElfReader::parseLineUnit( uint32_t pos, uint32_t end, bool dwarf64, QList<lineRow_t>* rows )
+{
+    uint16_t version = readU16( pos );
+    pos += 2;
+    if( version < 2 || version > 5 ) return;
+    if( version >= 5 ) pos += 2;     // address_size, segment_selector_size
+
+    int offSize = dwarf64 ? 8 : 4;
+    uint32_t program = pos+offSize+readU( pos, offSize );
+    pos += offSize;
+
+    uint8_t minInst = byte( pos++ );
+    if( version >= 4 ) pos++;        // maximum_operations_per_instruction
+    pos++;                           // default_is_stmt
+    int8_t  lineBase  = byte( pos++ );
+    uint8_t lineRange = byte( pos++ );
+    uint8_t opBase    = byte( pos++ );
+    if( !lineRange || !opBase ) return;
+
+    QList<uint8_t> opLengths;
+    for( int i=1; i<opBase; ++i ) opLengths.append( byte( pos++ ) );
+
+    QStringList dirs;
+    QList<int> files;        // Unit file number to m_files index
+
+    auto addFile = [&]( QString name, int dir ) -> int
+    {
+        QString dirPath = dirs.value( dir );
+        if( !QDir::isAbsolutePath( name ) && !dirPath.isEmpty() ) name = dirPath+"/"+name;
+        name = QDir::cleanPath( name );
+
+        int index = m_files.indexOf( name );
+        if( index < 0 ){
+            index = m_files.size();
+            m_files.append( name );
+        }
+        return index;
+    };
+
+    if( version < 5 )
+    {
+        dirs.append("");     // Dir 0 is compilation dir: not in this table
+        while( pos < end && byte( pos ) ) dirs.append( readStr( &pos ) );
+        pos++;
+
+        files.append( -1 );  // File numbers start at 1
+        while( pos < end && byte( pos ) )
+        {
+            QString name = readStr( &pos );
+            int dir = uleb( &pos );
+            uleb( &pos );    // modification time
+            uleb( &pos );    // file length
+            files.append( addFile( name, dir ) );
+        }
+        pos++;
+    }else{
+        QStringList paths;
+        QList<int> dirIndex;
+        if( !readEntries( &pos, end, dwarf64, &dirs, &dirIndex ) ) return;
+
+        dirIndex.clear();
+        if( !readEntries( &pos, end, dwarf64, &paths, &dirIndex ) ) return;
+
+        for( int i=0; i<paths.size(); ++i ) files.append( addFile( paths.at( i ), dirIndex.at( i ) ) );
+    }
+
+    uint32_t addr = 0;
+    int file = 1;
+    int line = 1;
+
+    auto addRow = [&]( bool endSeq ){ rows->append( { addr, files.value( file, -1 ), line, endSeq } ); };
+
+    pos = program;
+    while( pos < end )
+    {
+        uint8_t op = byte( pos++ );
+        if( op >= opBase )                      // Special opcode
+        {
+            int adj = op-opBase;
+            addr += (adj/lineRange)*minInst;
+            line += lineBase+adj%lineRange;
+            addRow( false );
+            continue;
+        }
+        switch( op )
+        {
+            case 0:                             // Extended opcode
+            {
+                uint32_t len  = uleb( &pos );
+                uint32_t next = pos+len;
+                uint8_t subOp = byte( pos++ );
+
+                if( subOp == DW_LNE_end_sequence )
+                {
+                    addRow( true );
+                    addr = 0;
+                    file = 1;
+                    line = 1;
+                }
+                else if( subOp == DW_LNE_set_address ) addr = readU( pos, len-1 );
+                else if( subOp == DW_LNE_define_file )
+                {
+                    QString name = readStr( &pos );
+                    files.append( addFile( name, uleb( &pos ) ) );
+                }
+                pos = next;
+            } break;
+            case DW_LNS_copy:         addRow( false );                 break;
+            case DW_LNS_advance_pc:   addr += uleb( &pos )*minInst;    break;
+            case DW_LNS_advance_line: line += sleb( &pos );            break;
+            case DW_LNS_set_file:     file  = uleb( &pos );            break;
+            case DW_LNS_const_add_pc: addr += ((255-opBase)/lineRange)*minInst; break;
+            case DW_LNS_fixed_advance_pc:
+                addr += readU16( pos );
+                pos += 2;
+                break;
+            case DW_LNS_negate_stmt:
+            case DW_LNS_set_basic_block:
+            case DW_LNS_set_prologue_end:
+            case DW_LNS_set_epilogue_beg: break;
+            default:                            // set_column, set_isa and unknown: skip arguments
+                for( int i=0; i<opLengths.at( op-1 ); ++i ) uleb( &pos );
+}   }   }
+
+bool ElfReader::readEntries( uint32_t* pos, uint32_t end, bool dwarf64, QStringList* paths, QList<int>* dirs )
+{
+    QList<QPair<uint64_t, uint64_t>> format; // Content type, Form
+    uint8_t formatCount = byte( (*pos)++ );
+    for( int i=0; i<formatCount; ++i )
+    {
+        uint64_t content = uleb( pos );
+        format.append( { content, uleb( pos ) } );
+    }
+    uint64_t count = uleb( pos );
+    int offSize = dwarf64 ? 8 : 4;
+
+    for( uint64_t i=0; i<count && *pos<end; ++i )
+    {
+        QString path;
+        int dir = 0;
+        for( QPair<uint64_t, uint64_t> entry : format )
+        {
+            QString str;
+            uint64_t value = 0;
+            switch( entry.second )
+            {
+                case DW_FORM_string: str = readStr( pos ); break;
+                case DW_FORM_strp:
+                case DW_FORM_line_strp:
+                {
+                    const section_t* strSec = section( entry.second == DW_FORM_strp ? ".debug_str" : ".debug_line_str" );
+                    uint32_t strPos = readU( *pos, offSize );
+                    *pos += offSize;
+                    if( strSec ){
+                        strPos += strSec->offset;
+                        str = readStr( &strPos );
+                }   } break;
+                case DW_FORM_udata:  value = uleb( pos );                     break;
+                case DW_FORM_data1:  value = byte( *pos );      *pos += 1;    break;
+                case DW_FORM_data2:  value = readU( *pos, 2 );  *pos += 2;    break;
+                case DW_FORM_data4:  value = readU( *pos, 4 );  *pos += 4;    break;
+                case DW_FORM_data8:  value = readU( *pos, 8 );  *pos += 8;    break;
+                case DW_FORM_data16: *pos += 16;                              break;
+                case DW_FORM_block:  { uint64_t len = uleb( pos ); *pos += len; } break;
+                default:
+                    qDebug() << "ElfReader Error: DWARF form not supported:" << entry.second;
+                    return false;
+            }
+            if     ( entry.first == DW_LNCT_path )            path = str;
+            else if( entry.first == DW_LNCT_directory_index ) dir  = value;
+        }
+        paths->append( path );
+        dirs->append( dir );
+    }
+    return true;
+}
+
+const ElfReader::section_t* ElfReader::section( QString name )
+{
+    for( const section_t& sec : m_sections ) if( sec.name == name ) return &sec;
+    return NULL;
+}
+
+uint64_t ElfReader::readU( uint32_t pos, int bytes )
+{
+    if( bytes < 1 || bytes > 8 || pos+bytes > (uint32_t)m_data.size() ) return 0;
+
+    const uchar* data = (const uchar*)m_data.constData()+pos;
+    uint64_t value = 0;
+    for( int i=0; i<bytes; ++i )
+    {
+        int b = m_bigEndian ? i : bytes-1-i;
+        value = (value << 8) | data[b];
+    }
+    return value;
+}
+
+uint8_t ElfReader::byte( uint32_t pos )
+{
+    if( pos >= (uint32_t)m_data.size() ) return 0;
+    return m_data.at( pos );
+}
+
+uint64_t ElfReader::uleb( uint32_t* pos )
+{
+    uint64_t value = 0;
+    int shift = 0;
+    while( *pos < (uint32_t)m_data.size() )
+    {
+        uint8_t b = m_data.at( (*pos)++ );
+        if( shift < 64 ) value |= (uint64_t)(b & 0x7F) << shift;
+        if( !(b & 0x80) ) break;
+        shift += 7;
+    }
+    return value;
+}
+
+int64_t ElfReader::sleb( uint32_t* pos )
+{
+    int64_t value = 0;
+    int shift = 0;
+    uint8_t b = 0;
+    while( *pos < (uint32_t)m_data.size() )
+    {
+        b = m_data.at( (*pos)++ );
+        if( shift < 64 ) value |= (int64_t)(b & 0x7F) << shift;
+        shift += 7;
+        if( !(b & 0x80) ) break;
+    }
+    if( shift < 64 && (b & 0x40) ) value |= -((int64_t)1 << shift); // Sign extend
+    return value;
+}
+
+QString ElfReader::readStr( uint32_t* pos )
+{
+    uint32_t size = m_data.size();
+    uint32_t start = *pos;
+    if( start >= size ) { (*pos)++; return ""; }
+
+    while( *pos < size && m_data.at( *pos ) ) (*pos)++;
+
+    QString str = QString::fromUtf8( m_data.constData()+start, *pos-start );
+    (*pos)++;                                 // Skip terminator
+    return str;
+}
@@ -0,0 +1,89 @@
+/***************************************************************************
+ *   Copyright (C) 2023 by Santiago González                               *
+ *                                                                         *
+ ***( see copyright.txt file at root folder )*******************************/
+
+#ifndef ELFREADER_H
+#define ELFREADER_H
+
+#include <QByteArray>
+#include <QStringList>
+#include <QList>
+
+#include <stdint.h>
+
+// Reads 32 bits ELF files produced by MCU toolchains (avr-gcc, xc8, etc):
+// loadable segments, symbol table and DWARF line table (.debug_line v2-v5).
+
+enum elfSymType_t{
+    ELF_SYM_OBJECT = 1,
+    ELF_SYM_FUNC   = 2,
+};
+
+class ElfReader
+{
+    public:
+        ElfReader();
+
+        struct segment_t{
+            uint32_t   addr;  // Physical (load) address
+            QByteArray data;
+        };
+        struct symbol_t{
+            QString  name;
+            QString  section;
+            uint32_t value;
+            uint32_t size;
+            int      type;    // elfSymType_t
+        };
+        struct lineRow_t{
+            uint32_t addr;
+            int      file;    // Index in files()
+            int      line;
+            bool     endSeq;  // Address after the end of a sequence
+        };
+
+        bool open( QString fileName );
+
+        int machine() { return m_machine; }
+
+        QList<segment_t> segments();
+        QList<symbol_t>  symbols();
+        QList<lineRow_t> lineTable();
+
+        QStringList files() { return m_files; } // Source files referenced by lineTable()
+
+ static bool isElf( QString fileName );
+
+    private:
+        struct section_t{
+            QString  name;
+            uint32_t type;
+            uint32_t addr;
+            uint32_t offset;
+            uint32_t size;
+            uint32_t link;
+        };
+
+        uint64_t readU( uint32_t pos, int bytes );
+        uint16_t readU16( uint32_t pos ) { return readU( pos, 2 ); }
+        uint32_t readU32( uint32_t pos ) { return readU( pos, 4 ); }
+        uint8_t  byte( uint32_t pos );
+        uint64_t uleb( uint32_t* pos );
+        int64_t  sleb( uint32_t* pos );
+        QString  readStr( uint32_t* pos ); // Advances pos after terminator
+
+        const section_t* section( QString name );
+
+        void parseLineUnit( uint32_t pos, uint32_t end, bool dwarf64, QList<lineRow_t>* rows );
+        bool readEntries( uint32_t* pos, uint32_t end, bool dwarf64, QStringList* paths, QList<int>* dirs );
+
+        QByteArray m_data;
+        bool m_bigEndian;
+        int  m_machine;
+
+        QList<section_t> m_sections;
+        QStringList      m_files;
+};
+
+#endif
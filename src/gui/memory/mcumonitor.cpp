@@ -23,6 +23,7 @@ MCUMonitor::MCUMonitor( QWidget* parent, eMcu* mcu )
     m_processor = mcu;
 
     m_jumpToAddress = false;
+    m_flashReload   = true;
 
     m_statusReg    = NULL;
     m_ramTable     = NULL;
@@ -100,6 +101,7 @@ void MCUMonitor::on_byteButton_toggled( bool byte )
     {
         int bytes = byte ? 1 : m_processor->wordSize();
         m_flashMonitor->setCellBytes( bytes );
+        m_flashReload = true;
     }
     updateStep();
 }
@@ -140,8 +142,9 @@ void MCUMonitor::updateStep()
     }
     if( m_ramMonitor && m_ramMonitor->isVisible() ) // RAM MemTable visible
     {
-        for( uint32_t i=0; i<m_processor->ramSize(); ++i )
-            m_ramMonitor->setValue( i, m_processor->getRamValue(i));
+        for( uint32_t i=0; i<m_processor->ramSize(); ++i ) // Only changed rows are repainted
+            m_ramMonitor->setValue( i, m_processor->getRawRam(i) );
+        m_ramMonitor->refresh();
 
         if(  Simulator::self()->simState() == SIM_RUNNING )
             m_ramMonitor->setAddrSelected( m_ramTable->getCurrentAddr(), m_jumpToAddress );
@@ -152,8 +155,19 @@ void MCUMonitor::updateStep()
     }
     if( m_flashMonitor && m_flashMonitor->isVisible() )
     {
-        for( uint32_t i=0; i<m_processor->flashSize(); ++i )
-            m_flashMonitor->setValue( i, m_processor->getFlashValue(i));
+        if( m_flashReload || m_processor->flashChanged() ) // Only rows written since last update
+        {
+            uint32_t flashSize = m_processor->flashSize();
+            for( uint32_t row=0; row*16<flashSize; ++row )
+            {
+                if( !m_flashReload && !m_processor->flashRowDirty( row ) ) continue;
+                for( uint32_t i=row*16; i<row*16+16 && i<flashSize; ++i )
+                    m_flashMonitor->setValue( i, m_processor->getFlashValue(i) );
+            }
+            m_processor->clearFlashDirty();
+            m_flashMonitor->refresh();
+            m_flashReload = false;
+        }
 
         if( Simulator::self()->simState() == SIM_RUNNING
          || Simulator::self()->simState() == SIM_PAUSED )
@@ -51,6 +51,7 @@ class MCUMonitor : public QDialog, private Ui::McuMonitor
         QTableWidget m_pc;
 
         bool m_jumpToAddress;
+        bool m_flashReload;   // Read whole Flash at next update
 };
 
 
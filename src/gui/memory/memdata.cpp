@@ -13,6 +13,7 @@
 #include "circuitwidget.h"
 #include "circuit.h"
 #include "mcuconfigword.h"
+#include "elfreader.h"
 #include "e_mcu.h"
 #include "utils.h"
 
@@ -61,18 +62,19 @@ bool MemData::loadData( QVector<int>* toData, bool resize, int bits )
 bool MemData::loadFile( QVector<int>* toData, QString file, bool resize, int bits, eMcu* eMcu )
 {
     m_eMcu = eMcu;
-    if( eMcu ) return loadHex( toData, file, resize, bits ); // MCUs file must be hex format
-
-    if( resize ) toData->resize( 1 );
-
     QString ext = getFileExt( file ).toLower();
 
     bool ok = false;
-    if     ( ext == ".data" ) ok = loadDat( toData, file, resize );
-    else if( ext == ".hex"
-          || ext == ".ihx" )  ok = loadHex( toData, file, resize, bits ); // Intel Hex Format
-    else                      ok = loadBin( toData, file, resize, bits ); // Binary Format
-
+    if( ext == ".elf" ) ok = loadElf( toData, file, resize && !eMcu, bits );
+    else if( eMcu ) ok = loadHex( toData, file, resize, bits ); // MCUs file must be hex or elf format
+    else{
+        if( resize ) toData->resize( 1 );
+
+        if     ( ext == ".data" ) ok = loadDat( toData, file, resize );
+        else if( ext == ".hex"
+              || ext == ".ihx" )  ok = loadHex( toData, file, resize, bits ); // Intel Hex Format
+        else                      ok = loadBin( toData, file, resize, bits ); // Binary Format
+    }
     m_eMcu = NULL;
     return ok;
 }
@@ -214,6 +216,66 @@ bool MemData::loadHex( QVector<int>* toData, QString file, bool resize, int bits
     return false;
 }
 
+bool MemData::loadElf( QVector<int>* toData, QString file, bool resize, int bits )
+{
+    qDebug() <<"Loading elf file:\n"<<file<<"\n";
+    ElfReader elf;
+    if( !elf.open( file ) ) return false;
+
+    int wordSize = (bits+7)/8;
+    bool avr = elf.machine() == 83;  // EM_AVR: Eeprom at 0x810000, fuses at 0x820000
+
+    QList<ElfReader::segment_t> segments = elf.segments();
+    if( resize )                     // Fit memory to program data
+    {
+        int memSize = 0;
+        for( ElfReader::segment_t segment : segments )
+        {
+            if( avr && segment.addr >= 0x800000 ) continue;
+            int end = (segment.addr+segment.data.size()+wordSize-1)/wordSize;
+            if( end > memSize ) memSize = end;
+        }
+        toData->fill( 0, memSize );
+    }
+    int dataEnd = toData->size()-1;
+
+    QVector<int> eeprom;
+    if( avr && m_eMcu ) eeprom = *m_eMcu->eeprom();
+    bool eepLoaded = false;
+
+    for( ElfReader::segment_t segment : segments )
+    {
+        const uchar* bytes = (const uchar*)segment.data.constData();
+        int size = segment.data.size();
+
+        if( avr && segment.addr >= 0x810000 && segment.addr < 0x820000 )
+        {
+            if( !m_eMcu ) continue;   // Eeprom only exists in Mcus
+            int addr = segment.addr-0x810000;
+            for( int i=0; i<size && addr+i<eeprom.size(); ++i ) eeprom[addr+i] = bytes[i];
+            eepLoaded = true;
+            continue;
+        }
+        if( avr && segment.addr >= 0x800000 ) continue; // Ram, fuses, lock bits, signature
+        int addr = segment.addr/wordSize;
+        for( int i=0; i<size; i+=wordSize )
+        {
+            int data = 0;
+            for( int by=0; by<wordSize && i+by<size; ++by ) data |= bytes[i+by] << (8*by); // little-endian
+
+            if( addr > dataEnd ){
+                if( !m_eMcu || !m_eMcu->setCfgWord( addr, data ) )
+                {
+                    qDebug() << "    Warning: Section out of PGM at Address:"<<"0x"+QString::number( segment.addr, 16 ).toUpper();
+                    break;
+            }   }
+            else toData->replace( addr, data );
+            addr++;
+    }   }
+    if( eepLoaded ) m_eMcu->setEeprom( &eeprom );
+    return true;
+}
+
 bool MemData::loadBin( QVector<int>* toData, QString fileName, bool resize, int bits )
 {
     int bytes = (bits+7)/8;
@@ -0,0 +1,171 @@
+/***************************************************************************
+ *   Copyright (C) 2023 by Santiago González                               *
+ *                                                                         *
+ ***( see copyright.txt file at root folder )*******************************/
+
+#include <math.h>
+#include <QColor>
+
+#include "memmodel.h"
+#include "utils.h"
+
+static const QStringList colLabels = QStringList()
+      <<"00"<<"01"<<"02"<<"03"<<"04"<<"05"<<"06"<<"07"
+      <<"08"<<"09"<<"0A"<<"0B"<<"0C"<<"0D"<<"0E"<<"0F"
+      << " "
+      <<"0"<<"1"<<"2"<<"3"<<"4"<<"5"<<"6"<<"7"
+      <<"8"<<"9"<<"A"<<"B"<<"C"<<"D"<<"E"<<"F";
+
+MemModel::MemModel( QObject* parent )
+        : QAbstractTableModel( parent )
+{
+    m_rows = 0;
+    m_cellBytes = 1;
+    m_addrBytes = 1;
+    m_firstChanged = -1;
+    m_lastChanged  = -1;
+}
+
+int MemModel::rowCount( const QModelIndex& parent ) const
+{
+    if( parent.isValid() ) return 0;
+    return m_rows;
+}
+
+int MemModel::columnCount( const QModelIndex& parent ) const
+{
+    if( parent.isValid() ) return 0;
+    return 33;
+}
+
+QVariant MemModel::data( const QModelIndex& index, int role ) const
+{
+    int col = index.column();
+    if( !index.isValid() || col == 16 ) return QVariant();
+
+    int address = index.row()*16 + col%17;
+    if( address >= m_values.size() ) return QVariant();
+    int val = m_values.at( address );
+
+    switch( role )
+    {
+        case Qt::DisplayRole:
+        case Qt::EditRole:
+            if( col < 16 ) return valToHex( val, m_cellBytes );
+            return asciiStr( val );
+        case Qt::FontRole:
+        {
+            QFont font = m_font;
+            font.setWeight( col < 16 ? QFont::DemiBold : QFont::Medium );
+            return font;
+        }
+        case Qt::ForegroundRole:
+            if( col < 16 ) return QColor( 0x202090 );
+            break;
+        case Qt::TextAlignmentRole:
+            return int( Qt::AlignCenter );
+        case Qt::ToolTipRole:
+            return "Addr: 0x"+valToHex( address, m_addrBytes )
+                  +"\nDec: "+decToBase( val, 10, 2*m_cellBytes+1 )
+                  +"\nOct: "+decToBase( val,  8, 3*m_cellBytes )
+                  +"\nBin: "+decToBase( val,  2, 8*m_cellBytes );
+    }
+    return QVariant();
+}
+
+QVariant MemModel::headerData( int section, Qt::Orientation orientation, int role ) const
+{
+    if( role == Qt::FontRole ) return m_font;
+    if( role != Qt::DisplayRole ) return QVariant();
+
+    if( orientation == Qt::Horizontal ) return colLabels.value( section );
+    return " 0x"+valToHex( section*16, m_addrBytes )+" ";
+}
+
+Qt::ItemFlags MemModel::flags( const QModelIndex& index ) const
+{
+    if( !index.isValid() || index.column() == 16 ) return Qt::NoItemFlags;
+    return Qt::ItemIsEnabled | Qt::ItemIsSelectable | Qt::ItemIsEditable;
+}
+
+bool MemModel::setData( const QModelIndex& index, const QVariant& value, int role )
+{
+    if( role != Qt::EditRole || !index.isValid() ) return false;
+
+    int col = index.column();
+    if( col == 16 ) return false;
+
+    int address = index.row()*16 + col%17;
+    if( address >= m_values.size() ) return false;
+
+    QString text = value.toString();
+    int val = 0;
+    bool ok;
+
+    if( col > 16 )
+    {
+        ok = text.size() == m_cellBytes;
+        if( ok ){
+            for( int i=0; i<m_cellBytes; ++i )
+                val += text.at( m_cellBytes-i-1 ).cell() << (8*i);
+    }   }
+    else val = text.toInt( &ok, 0 );
+
+    if( !ok ) return false;
+
+    m_values[address] = val;
+    emit dataChanged( this->index( index.row(), col%17 ), this->index( index.row(), col%17+17 ) );
+    emit cellEdited( address, val );
+    return true;
+}
+
+void MemModel::resetCells( int cells, int cellBytes )
+{
+    beginResetModel();
+    m_values.fill( 0, cells );
+    m_cellBytes = cellBytes;
+    m_addrBytes = ceil( ceil(log2(cells))/8 );
+    m_rows = cells/16;
+    if( cells%16 ) m_rows++;
+    m_firstChanged = -1;
+    m_lastChanged  = -1;
+    endResetModel();
+}
+
+void MemModel::setCellValue( int address, int val )
+{
+    if( address >= m_values.size() ) return;
+    if( m_values.at( address ) == val ) return;
+    m_values[address] = val;
+
+    int row = address/16;
+    if( m_firstChanged < 0 || row < m_firstChanged ) m_firstChanged = row;
+    if( row > m_lastChanged ) m_lastChanged = row;
+}
+
+void MemModel::flush()
+{
+    if( m_firstChanged < 0 ) return;
+    emit dataChanged( index( m_firstChanged, 0 ), index( m_lastChanged, 32 ) );
+    m_firstChanged = -1;
+    m_lastChanged  = -1;
+}
+
+QString MemModel::asciiStr( int val ) const
+{
+    QString valS = QChar( val&0x00FF );
+    for( int i=1; i<m_cellBytes; ++i )
+    {
+        val >>= 8;
+        valS.prepend( QString( QChar( val&0x00FF )) );
+    }
+    return valS;
+}
+
+QString MemModel::valToHex( int val, int bytes )
+{
+    QString sval = QString::number( val, 16 ).toUpper();
+    sval = sval.right( bytes*2 );
+    while( sval.length() < bytes*2) sval.prepend( "0" );
+    return sval;
+}
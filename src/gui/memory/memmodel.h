@@ -0,0 +1,60 @@
+/***************************************************************************
+ *   Copyright (C) 2023 by Santiago González                               *
+ *                                                                         *
+ ***( see copyright.txt file at root folder )*******************************/
+
+#ifndef MEMMODEL_H
+#define MEMMODEL_H
+
+#include <QAbstractTableModel>
+#include <QVector>
+#include <QFont>
+
+// Hex dump model for MemTable: 16 cells + separator + 16 ascii per row
+// Text is only generated for cells the view asks for (visible cells).
+
+class MemModel : public QAbstractTableModel
+{
+    Q_OBJECT
+
+    public:
+        MemModel( QObject* parent=0 );
+
+        int rowCount( const QModelIndex& parent=QModelIndex() ) const override;
+        int columnCount( const QModelIndex& parent=QModelIndex() ) const override;
+
+        QVariant data( const QModelIndex& index, int role=Qt::DisplayRole ) const override;
+        QVariant headerData( int section, Qt::Orientation orientation, int role=Qt::DisplayRole ) const override;
+        Qt::ItemFlags flags( const QModelIndex& index ) const override;
+        bool setData( const QModelIndex& index, const QVariant& value, int role=Qt::EditRole ) override;
+
+        void resetCells( int cells, int cellBytes );
+        void setFont( QFont font ) { m_font = font; }
+
+        int  cells() { return m_values.size(); }
+        int  cellValue( int address ) { return m_values.at( address ); }
+        void setCellValue( int address, int val );
+
+        void flush(); // Notify views about rows changed since last flush
+
+ static QString valToHex( int val, int bytes );
+
+    signals:
+        void cellEdited( int address, int val );
+
+    private:
+        QString asciiStr( int val ) const;
+
+        int m_rows;
+        int m_cellBytes;
+        int m_addrBytes;
+
+        int m_firstChanged;
+        int m_lastChanged;
+
+        QFont m_font;
+
+        QVector<int> m_values; // Cell values
+};
+
+#endif
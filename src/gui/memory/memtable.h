@@ -9,6 +9,7 @@
 #include <QWidget>
 
 #include "ui_memtable.h"
+#include "memmodel.h"
 
 class Component;
 class QAction;
@@ -25,37 +26,33 @@ class MemTable : public QWidget, private Ui::MemTable
         void setValue( int address, int val );
         void setCellBytes( int bytes );
         void setAddrSelected( int addr ,bool jump );
+        void refresh() { m_model.flush(); }
 
     signals:
         void dataChanged( int address, int val );
 
     public slots:
-        void on_table_itemChanged( QTableWidgetItem* item );
-        void on_table_cellClicked( int row, int col ) { cellClicked( row, col ); }
-        void on_table_itemEntered( QTableWidgetItem* item );
+        void on_table_clicked( const QModelIndex& index ) { cellClicked( index.row(), index.column() ); }
         void on_context_menu_requested( const QPoint &pos );
         void saveTable();
         void loadTable();
 
     private:
         void resizeTable( int dataSize );
-        void setCellValue( int address, int val );
+        void cellEdited( int address, int val );
         void cellClicked( int row, int col );
-        QString valToHex( int val, int bytes );
         QVector<int> toIntVector();
 
+        MemModel m_model;
+
         int m_updtCount;
         int m_dataSize;
         int m_wordBytes;
         int m_cellBytes;
         int m_byteRatio; // m_wordBytes/m_cellBytes
-        int m_addrBytes;
-
-        bool m_blocked;
 
         bool m_canSaveLoad;
 
-        QTableWidgetItem* m_hoverItem;
         QVector<int>* m_data;
 };
 
@@ -33,9 +33,16 @@ OutPanelText::OutPanelText( QWidget* parent )
 }
 OutPanelText::~OutPanelText(){}
 
+void OutPanelText::appendText( const QString text )
+{
+    m_textBuffer.append( text );
+    if( m_textBuffer.size() > maxPanelChars )   // Not shown yet: keep only what fits in Panel
+        m_textBuffer.remove( 0, m_textBuffer.size()-maxPanelChars+trimChars );
+}
+
 void OutPanelText::appendLine( const QString text )
 {
-    m_textBuffer.append( text+"\n" );
+    appendText( text+"\n" );
     if( !Simulator::self() || !Simulator::self()->isRunning() )
     {
         updateStep();
@@ -51,12 +58,21 @@ void OutPanelText::updateStep()
     insertPlainText( m_textBuffer );
     m_textBuffer.clear();
 
-    if( this->document()->characterCount() > 100000 )
-        setPlainText( this->toPlainText().right( 90000 ) );
-
+    int chars = document()->characterCount();
+    if( chars > maxPanelChars ) // Remove oldest text, the rest of the document is not laid out again
+    {
+        QTextCursor cursor( document() );
+        cursor.movePosition( QTextCursor::NextCharacter, QTextCursor::KeepAnchor, chars-maxPanelChars+trimChars );
+        cursor.removeSelectedText();
+    }
     moveCursor( QTextCursor::End );
 }
 
+void OutPanelText::setHighlight( bool h )
+{
+    m_highlighter->setDocument( h ? document() : NULL );
+}
+
 // CLASS OutHighlighter ***********************************************
 
 OutHighlighter::OutHighlighter( QTextDocument* parent )
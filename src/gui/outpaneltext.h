@@ -12,6 +12,9 @@
 
 #include "updatable.h"
 
+#define maxPanelChars 100000 // Panel and pending text are trimmed to this size
+#define trimChars      10000 // Oldest text removed at once
+
 class OutHighlighter;
 
 class OutPanelText : public QPlainTextEdit, public Updatable
@@ -23,9 +26,11 @@ class OutPanelText : public QPlainTextEdit, public Updatable
 
         virtual void updateStep() override;
 
-        void appendText( const QString text ) { m_textBuffer.append( text ); }
+        void appendText( const QString text );
         void appendLine( const QString text );
 
+        void setHighlight( bool h ); // Serial data doesn't need syntax highlighting
+
     private:
         QString m_textBuffer;
  
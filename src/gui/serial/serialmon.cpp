@@ -3,6 +3,9 @@
  *                                                                         *
  ***( see copyright.txt file at root folder )*******************************/
 
+#include <QFileDialog>
+#include <QDebug>
+
 #include "serialmon.h"
 #include "usartmodule.h"
 #include "simulator.h"
@@ -42,13 +45,20 @@ SerialMonitor::SerialMonitor( QWidget* parent, UsartModule* usart, bool send )
     m_printMode = 0;
     m_addCR = false;
     m_paused = false;
+    m_inCol  = 0;
+    m_outCol = 0;
+
+    m_uartInPanel.setHighlight( false );
+    m_uartOutPanel.setHighlight( false );
 
     Simulator::self()->addToUpdateList( this );
 }
 
 void SerialMonitor::updateStep()
 {
-    if( isVisible() && !m_paused ){
+    if( isVisible() && !m_paused ){        // One batch per frame
+        m_uartInPanel.appendText( dataToString( &m_inData, &m_inCol ) );
+        m_uartOutPanel.appendText( dataToString( &m_outData, &m_outCol ) );
         m_uartInPanel.updateStep();
         m_uartOutPanel.updateStep();
     }
@@ -68,6 +78,42 @@ void SerialMonitor::on_pauseButton_clicked()
     else           pauseButton->setText( tr("Pause") );
 }
 
+void SerialMonitor::on_logButton_clicked()
+{
+    QString fileName;
+    if( logButton->isChecked() )
+    {
+        fileName = QFileDialog::getSaveFileName( this, tr("Log data to file"), m_logFile.fileName(),
+                                                 tr("All files (*.*)") );
+        if( fileName.isEmpty() ) logButton->setChecked( false );
+    }
+    Simulator::self()->waitCircuit(); // Simulation thread writes to log file
+    if( m_logFile.isOpen() ) m_logFile.close();
+    if( fileName.isEmpty() ) return;
+
+    m_logFile.setFileName( fileName );
+    if( !m_logFile.open( QIODevice::WriteOnly | QIODevice::Truncate ) )
+    {
+        qDebug() << "SerialMonitor Error: can't open file" << fileName;
+        logButton->setChecked( false );
+}   }
+
+void SerialMonitor::on_clearIn_clicked()
+{
+    Simulator::self()->waitCircuit(); // Simulation thread writes to m_inData
+    m_uartInPanel.clear();
+    m_inData.clear();
+    m_inCol = 0;
+}
+
+void SerialMonitor::on_clearOut_clicked()
+{
+    Simulator::self()->waitCircuit(); // Simulation thread writes to m_outData
+    m_uartOutPanel.clear();
+    m_outData.clear();
+    m_outCol = 0;
+}
+
 void SerialMonitor::on_text_returnPressed()
 {
     if( m_paused ) return;
@@ -90,13 +136,30 @@ void SerialMonitor::on_printBox_currentIndexChanged( int index )
 void SerialMonitor::printIn( int value ) // Receive one byte on Uart
 {
     if( m_paused ) return;
-    m_uartInPanel.appendText( valToString( value ) );
+    addByte( &m_inData, value );
 }
 
 void SerialMonitor::printOut( int value ) // Send value to OutPanelText
 {
+    if( m_logFile.isOpen() ) m_logFile.putChar( value ); // Also when paused
     if( m_paused ) return;
-    m_uartOutPanel.appendText( valToString( value ) );
+    addByte( &m_outData, value );
+}
+
+QString SerialMonitor::dataToString( QByteArray* data, int* col )
+{
+    QString text;
+    if( data->isEmpty() ) return text;
+
+    if( m_printMode == 0 ) text = QString::fromLatin1( data->constData(), data->size() ); // ASCII
+    else{
+        for( char byte : *data )
+        {
+            text.append( valToString( byte ) );
+            if( ++(*col) == 16 ) { *col = 0; text.append("\n"); } // 16 values per line
+    }   }
+    data->clear();
+    return text;
 }
 
 QString SerialMonitor::valToString( int val )
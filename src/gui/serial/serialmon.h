@@ -7,11 +7,14 @@
 #define SERIALMON_H
 
 #include <QDialog>
+#include <QFile>
 
 #include "ui_serialmon.h"
 #include "outpaneltext.h"
 #include "updatable.h"
 
+#define maxPending 16384 // Bytes kept while panel is not updated
+
 class UsartModule;
 
 class SerialMonitor : public QDialog, private Ui::SerialMonitor, public Updatable
@@ -34,14 +37,22 @@ class SerialMonitor : public QDialog, private Ui::SerialMonitor, public Updatabl
         void on_printBox_currentIndexChanged( int index );
         void on_addCrButton_clicked() { m_addCR = addCrButton->isChecked(); }
         void on_pauseButton_clicked();
-        void on_clearIn_clicked() { m_uartInPanel.clear(); }
-        void on_clearOut_clicked() { m_uartOutPanel.clear(); }
+        void on_logButton_clicked();
+        void on_clearIn_clicked();
+        void on_clearOut_clicked();
 
     protected:
         void closeEvent( QCloseEvent* event ) override;
 
     private:
         QString valToString( int val );
+        QString dataToString( QByteArray* data, int* col );
+
+        inline void addByte( QByteArray* data, int value )
+        {
+            if( data->size() >= maxPending ) data->remove( 0, maxPending/2 ); // Drop oldest
+            data->append( value );
+        }
 
         OutPanelText m_uartInPanel;
         OutPanelText m_uartOutPanel;
@@ -53,6 +64,13 @@ class SerialMonitor : public QDialog, private Ui::SerialMonitor, public Updatabl
         bool m_paused;
 
         QByteArray m_outBuffer;
+
+        QByteArray m_inData;  // Raw bytes received since last update
+        QByteArray m_outData; // Raw bytes sent since last update
+        int m_inCol;          // Values printed in current line (not ASCII)
+        int m_outCol;
+
+        QFile m_logFile;      // Raw stream of sent bytes, written from Simulation thread
 };
 
 #endif
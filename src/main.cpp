@@ -10,6 +10,8 @@
 
 #include "mainwindow.h"
 #include "circuitwidget.h"
+#include "circuit.h"
+#include "paramsweep.h"
 
 void myMessageOutput( QtMsgType type, const QMessageLogContext &context, const QString &msg )
 {
@@ -46,6 +48,29 @@ QString langFile( QString locale )
     return langF;
 }
 
+// Parameter sweep worker, started by ParamSweep:
+// simulide <circuit> --sweep <sweep file> --seed <n> --runs <first> <count> --out <csv file>
+int sweepWorker( QStringList args )
+{
+    int sweepArg = args.indexOf("--sweep");
+    int seedArg  = args.indexOf("--seed");
+    int runsArg  = args.indexOf("--runs");
+    int outArg   = args.indexOf("--out");
+    if( sweepArg < 2 || seedArg < 2 || runsArg < 2 || outArg < 2
+     || args.size() <= qMax( qMax( sweepArg+1, seedArg+1 ), qMax( runsArg+2, outArg+1 ) ) ) return 1;
+
+    CircuitWidget::self()->newCircuit();
+    Circuit::self()->loadCircuit( args.at( 1 ) );
+
+    ParamSweep sweep;
+    sweep.setSeed( args.at( seedArg+1 ).toUInt() );
+    if( !sweep.loadFile( args.at( sweepArg+1 ) ) ) return 1;
+
+    int first = args.at( runsArg+1 ).toInt();
+    int count = args.at( runsArg+2 ).toInt();
+    return sweep.runWorker( args.at( outArg+1 ), first, count ) ? 0 : 1;
+}
+
 int main( int argc, char *argv[] )
 {
     qInstallMessageHandler( myMessageOutput );
@@ -73,6 +98,8 @@ int main( int argc, char *argv[] )
     MainWindow window;
     window.setLoc( locale );
 
+    if( app.arguments().contains("--sweep") ) return sweepWorker( app.arguments() );
+
     if( argc > 1 )
     {
         QString circ = QString::fromStdString( argv[1] );
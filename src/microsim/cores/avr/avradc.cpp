@@ -3,6 +3,8 @@
  *                                                                         *
  ***( see copyright.txt file at root folder )*******************************/
 
+#include <QDataStream>
+
 #include "avradc.h"
 #include "avrtimer.h"
 #include "mcuocunit.h"
@@ -133,6 +135,34 @@ void AvrAdc::setChannel( uint8_t newADMUX ) // ADMUX
     if( m_acme && !m_enabled ) m_mcu->comparator()->setPinN( m_adcPin[m_channel] );
 }
 
+bool AvrAdc::saveState( QDataStream& s )
+{
+    McuAdc::saveState( s );
+    s << m_acme << m_autoTrigger << m_freeRunning << m_initCycles << m_refSelect << m_trigger;
+    return true;
+}
+
+bool AvrAdc::loadState( QDataStream& s, bool check )
+{
+    if( !McuAdc::loadState( s, check ) ) return false;
+
+    bool acme, autoTrigger, freeRunning;
+    uint initCycles;
+    uint8_t refSelect, trigger;
+    s >> acme >> autoTrigger >> freeRunning >> initCycles >> refSelect >> trigger;
+    if( check || s.status() != QDataStream::Ok ) return s.status() == QDataStream::Ok;
+
+    m_acme        = acme;
+    m_autoTrigger = autoTrigger;
+    m_initCycles  = initCycles;
+    m_refSelect   = refSelect;
+    m_trigger     = trigger;
+
+    autotriggerConf(); // Restore Interrupt callbacks
+    m_freeRunning = freeRunning;
+    return true;
+}
+
 void AvrAdc::endConversion()
 {
     clearRegBits( m_ADSC ); // Clear ADSC bit
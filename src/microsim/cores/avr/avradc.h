@@ -30,6 +30,9 @@ class AvrAdc : public McuAdc
         virtual void setChannel( uint8_t newADMUX ) override;
         virtual void callBack() override { if( !m_converting ) startConversion(); }
 
+        virtual bool saveState( QDataStream& s ) override;
+        virtual bool loadState( QDataStream& s, bool check ) override;
+
     protected:
         void updateAcme( uint8_t newVal );
         virtual void autotriggerConf(){;}
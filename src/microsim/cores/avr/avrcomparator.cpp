@@ -3,6 +3,8 @@
  *                                                                         *
  ***( see copyright.txt file at root folder )*******************************/
 
+#include <QDataStream>
+
 #include "avrcomparator.h"
 #include "datautils.h"
 #include "regwatcher.h"
@@ -76,6 +78,28 @@ void AvrComp::configureC( uint8_t newACOE ) // mega328PB
     changeCallbacks();
 }
 
+bool AvrComp::saveState( QDataStream& s )
+{
+    McuComp::saveState( s );
+    s << m_acie << m_acoe;
+    return true;
+}
+
+bool AvrComp::loadState( QDataStream& s, bool check )
+{
+    if( !McuComp::loadState( s, check ) ) return false;
+
+    bool acie, acoe;
+    s >> acie >> acoe;
+    if( check || s.status() != QDataStream::Ok ) return s.status() == QDataStream::Ok;
+
+    m_acie = acie;
+    m_acoe = acoe;
+
+    changeCallbacks();
+    return true;
+}
+
 void AvrComp::readACO( uint8_t )
 {
     if( !m_enabled ) return;
@@ -24,6 +24,9 @@ class AvrComp : public McuComp
 
         virtual void setPinN( McuPin* pin ) override;
 
+        virtual bool saveState( QDataStream& s ) override;
+        virtual bool loadState( QDataStream& s, bool check ) override;
+
         void readACO( uint8_t );
 
     protected:
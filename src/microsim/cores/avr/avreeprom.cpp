@@ -3,6 +3,8 @@
  *                                                                         *
  ***( see copyright.txt file at root folder )*******************************/
 
+#include <QDataStream>
+
 #include "avreeprom.h"
 #include "datautils.h"
 #include "e_mcu.h"
@@ -37,6 +39,27 @@ void AvrEeprom::runEvent() // Write cycle end reached
     else        clearRegBits( m_EEPE );             // Read operation took place: clear EEPE
 }
 
+bool AvrEeprom::saveState( QDataStream& s )
+{
+    McuEeprom::saveState( s );
+    s << (quint64)m_nextCycle << m_mode;
+    return true;
+}
+
+bool AvrEeprom::loadState( QDataStream& s, bool check )
+{
+    if( !McuEeprom::loadState( s, check ) ) return false;
+
+    quint64 nextCycle;
+    uint8_t mode;
+    s >> nextCycle >> mode;
+    if( check || s.status() != QDataStream::Ok ) return s.status() == QDataStream::Ok;
+
+    m_nextCycle = nextCycle;
+    m_mode      = mode;
+    return true;
+}
+
 void AvrEeprom::configureA( uint8_t newEECR ) // EECR is being written
 {
     bool eempe = getRegBitsBool( newEECR, m_EEMPE );
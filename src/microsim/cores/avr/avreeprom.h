@@ -23,6 +23,9 @@ class AvrEeprom : public McuEeprom
 
         virtual void writeEeprom() override;
 
+        virtual bool saveState( QDataStream& s ) override;
+        virtual bool loadState( QDataStream& s, bool check ) override;
+
     private:
         uint64_t m_nextCycle;
 
@@ -3,6 +3,8 @@
  *                                                                         *
  ***( see copyright.txt file at root folder )*******************************/
 
+#include <QDataStream>
+
 #include "avrtimer.h"
 #include "datautils.h"
 #include "avrocunit.h"
@@ -45,6 +47,28 @@ void AvrTimer::initialize()
     m_wgm32Val = 0;
 }
 
+bool AvrTimer::saveState( QDataStream& s )
+{
+    McuTimer::saveState( s );
+    s << (qint32)m_wgmMode << m_wgm10Val << m_wgm32Val;
+    return true;
+}
+
+bool AvrTimer::loadState( QDataStream& s, bool check )
+{
+    if( !McuTimer::loadState( s, check ) ) return false;
+
+    qint32 wgmMode;
+    uint8_t wgm10Val, wgm32Val;
+    s >> wgmMode >> wgm10Val >> wgm32Val;
+    if( check || s.status() != QDataStream::Ok ) return s.status() == QDataStream::Ok;
+
+    m_wgmMode  = (wgmMode_t)wgmMode;
+    m_wgm10Val = wgm10Val;
+    m_wgm32Val = wgm32Val;
+    return true;
+}
+
 void AvrTimer::addOcUnit( McuOcUnit* ocUnit )
 {
     m_ocUnit.emplace_back( ocUnit );
@@ -408,6 +432,25 @@ void AvrTimer16bit::runEvent()            // Overflow
     McuTimer::runEvent();
 }
 
+bool AvrTimer16bit::saveState( QDataStream& s )
+{
+    AvrTimer::saveState( s );
+    s << m_useICR;
+    return true;
+}
+
+bool AvrTimer16bit::loadState( QDataStream& s, bool check )
+{
+    if( !AvrTimer::loadState( s, check ) ) return false;
+
+    bool useICR;
+    s >> useICR;
+    if( check || s.status() != QDataStream::Ok ) return s.status() == QDataStream::Ok;
+
+    m_useICR = useICR;
+    return true;
+}
+
 void AvrTimer16bit::updtWgm()
 {
     uint8_t WGM = m_wgm32Val + m_wgm10Val;
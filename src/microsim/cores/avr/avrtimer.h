@@ -33,6 +33,9 @@ class AvrTimer : public McuTimer
         virtual void configureA( uint8_t newTCCRXA ) override;
         virtual void configureB( uint8_t newTCCRXB ) override;
 
+        virtual bool saveState( QDataStream& s ) override;
+        virtual bool loadState( QDataStream& s, bool check ) override;
+
     protected:
         virtual void updtWgm(){;}
         virtual void configureClock();
@@ -138,6 +141,9 @@ class AvrTimer16bit : public AvrTimer
 
         virtual void runEvent() override;
 
+        virtual bool saveState( QDataStream& s ) override;
+        virtual bool loadState( QDataStream& s, bool check ) override;
+
         virtual void topReg0Changed( uint8_t val ) override;
         void ICRXLchanged( uint8_t val );
         //void ICRXHchanged( uint8_t val );
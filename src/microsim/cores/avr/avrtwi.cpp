@@ -3,6 +3,8 @@
  *                                                                         *
  ***( see copyright.txt file at root folder )*******************************/
 
+#include <QDataStream>
+
 #include "avrtwi.h"
 #include "mcupin.h"
 #include "e_mcu.h"
@@ -99,6 +101,25 @@ void AvrTwi::configureA( uint8_t newTWCR ) // TWCR is being written
     }
 }
 
+bool AvrTwi::saveState( QDataStream& s )
+{
+    McuTwi::saveState( s );
+    s << m_bitRate;
+    return true;
+}
+
+bool AvrTwi::loadState( QDataStream& s, bool check )
+{
+    if( !McuTwi::loadState( s, check ) ) return false;
+
+    uint8_t bitRate;
+    s >> bitRate;
+    if( check || s.status() != QDataStream::Ok ) return s.status() == QDataStream::Ok;
+
+    m_bitRate = bitRate;
+    return true;
+}
+
 void AvrTwi::configureB( uint8_t val )       // TWBR is being written
 {
     if( m_bitRate == val ) return;
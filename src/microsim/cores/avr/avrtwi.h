@@ -20,6 +20,9 @@ class AvrTwi : public McuTwi
 
         virtual void initialize() override;
 
+        virtual bool saveState( QDataStream& s ) override;
+        virtual bool loadState( QDataStream& s, bool check ) override;
+
         virtual void configureA( uint8_t newTWCR ) override;
         virtual void configureB( uint8_t val ) override;
 
@@ -3,6 +3,8 @@
  *                                                                         *
  ***( see copyright.txt file at root folder )*******************************/
 
+#include <QDataStream>
+
 #include "avrusart.h"
 #include "usarttx.h"
 #include "usartrx.h"
@@ -128,6 +130,27 @@ void AvrUsart::configureC( uint8_t newUCSRnC ) // UCSRnC changed
     }*/
 }
 
+bool AvrUsart::saveState( QDataStream& s )
+{
+    McuUsart::saveState( s );
+    s << m_UBRRHval << m_ucsz01 << m_ucsz2;
+    return true;
+}
+
+bool AvrUsart::loadState( QDataStream& s, bool check )
+{
+    if( !McuUsart::loadState( s, check ) ) return false;
+
+    uint8_t UBRRHval, ucsz01, ucsz2;
+    s >> UBRRHval >> ucsz01 >> ucsz2;
+    if( check || s.status() != QDataStream::Ok ) return s.status() == QDataStream::Ok;
+
+    m_UBRRHval = UBRRHval;
+    m_ucsz01   = ucsz01;
+    m_ucsz2    = ucsz2;
+    return true;
+}
+
 void AvrUsart::setUBRRnL( uint8_t v )
 {
     if( *m_UBRRnL == v ) return;
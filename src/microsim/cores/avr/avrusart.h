@@ -26,6 +26,9 @@ class AvrUsart : public McuUsart
 
         virtual void setRxFlags( uint16_t frame ) override;
 
+        virtual bool saveState( QDataStream& s ) override;
+        virtual bool loadState( QDataStream& s, bool check ) override;
+
         void setBaurrate( uint8_t ubrr=0 );
 
     private:
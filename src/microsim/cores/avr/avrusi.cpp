@@ -4,6 +4,7 @@
  ***( see copyright.txt file at root folder )*******************************/
 
 #include <QDebug>
+#include <QDataStream>
 
 #include "avrusi.h"
 #include "e_mcu.h"
@@ -86,6 +87,44 @@ void AvrUsi::voltChanged()  // Clk Pin changed
     m_clkState = clkState;
 }
 
+bool AvrUsi::saveState( QDataStream& s )
+{
+    saveModule( s );
+    s << m_twi << m_spi << m_timer << m_extClk << m_usiClk << m_clkEdge << m_clkState << m_sdaState << m_DoState;
+    s << m_mode << m_clockMode << m_counter;
+    return true;
+}
+
+bool AvrUsi::loadState( QDataStream& s, bool check )
+{
+    if( !loadModule( s, check ) ) return false;
+
+    bool twi, spi, timer, extClk, usiClk, clkEdge, clkState, sdaState, doState;
+    uint8_t mode, clockMode, counter;
+    s >> twi >> spi >> timer >> extClk >> usiClk >> clkEdge >> clkState >> sdaState >> doState;
+    s >> mode >> clockMode >> counter;
+    if( check || s.status() != QDataStream::Ok ) return s.status() == QDataStream::Ok;
+
+    m_twi       = twi;
+    m_spi       = spi;
+    m_timer     = timer;
+    m_extClk    = extClk;
+    m_usiClk    = usiClk;
+    m_clkEdge   = clkEdge;
+    m_clkState  = clkState;
+    m_sdaState  = sdaState;
+    m_DoState   = doState;
+    m_mode      = mode;
+    m_clockMode = clockMode;
+    m_counter   = counter;
+
+    if( m_DIpin ) m_DIpin->changeCallBack( this, m_twi );
+    if( m_CKpin ) m_CKpin->changeCallBack( this, m_extClk );
+    m_t0OCA->getInterrupt()->callBack( this, m_timer );
+    m_t0OCB->getInterrupt()->callBack( this, m_timer );
+    return true;
+}
+
 void AvrUsi::callBack()  // Called at Timer0 Compare Match
 {
     stepCounter();
@@ -24,6 +24,9 @@ class AvrUsi : public McuModule, public eElement
         virtual void reset() override;
         virtual void voltChanged() override;
 
+        virtual bool saveState( QDataStream& s ) override;
+        virtual bool loadState( QDataStream& s, bool check ) override;
+
         virtual void configureA( uint8_t ) override;
         virtual void configureB( uint8_t ) override;
         virtual void callBack() override; // Called at Timer0 Compare Match
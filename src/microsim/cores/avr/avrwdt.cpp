@@ -3,6 +3,8 @@
  *                                                                         *
  ***( see copyright.txt file at root folder )*******************************/
 
+#include <QDataStream>
+
 #include "avrwdt.h"
 #include "e_mcu.h"
 #include "cpubase.h"
@@ -68,6 +70,28 @@ void AvrWdt::callBack() // WDT Overflow Interrupt just executed
     m_mcu->cpu()->reset();
 }
 
+bool AvrWdt::saveState( QDataStream& s )
+{
+    McuWdt::saveState( s );
+    s << m_allowChanges << m_disabled;
+    return true;
+}
+
+bool AvrWdt::loadState( QDataStream& s, bool check )
+{
+    if( !McuWdt::loadState( s, check ) ) return false;
+
+    bool allowChanges, disabled;
+    s >> allowChanges >> disabled;
+    if( check || s.status() != QDataStream::Ok ) return s.status() == QDataStream::Ok;
+
+    m_allowChanges = allowChanges;
+    m_disabled     = disabled;
+
+    if( m_interrupt ) m_interrupt->exitCallBack( this, m_ovfInter && m_ovfReset );
+    return true;
+}
+
 void AvrWdt::configureA( uint8_t newWDTCSR ) // WDTCSR Written
 {
     bool WDE  = getRegBitsBool( newWDTCSR, m_WDE );
@@ -27,6 +27,9 @@ class AvrWdt : public McuWdt
 
         virtual void callBack() override;
 
+        virtual bool saveState( QDataStream& s ) override;
+        virtual bool loadState( QDataStream& s, bool check ) override;
+
     protected:
         void wdtEnable();
         virtual void updtPrescaler( uint8_t newWDTCSR ){;}
@@ -9,6 +9,8 @@
 #include "e_mcu.h"
 #include "corebase.h"
 
+class QDataStream;
+
 #define REG_SPL      m_spl[0]
 #define REG_SPH      m_sph[0]
 #define STATUS(bit) (*m_STATUS & (1<<bit))
@@ -33,6 +35,9 @@ class CpuBase : public CoreBase
 
         virtual void exitSleep() {;}
 
+        virtual bool saveState( QDataStream& ){ return false; } // Simulation checkpoint: registers not in Ram
+        virtual bool loadState( QDataStream&, bool ){ return false; } // False if not supported
+
     protected:
         eMcu* m_mcu;
 
@@ -3,6 +3,8 @@
  *                                                                         *
  ***( see copyright.txt file at root folder )*******************************/
 
+#include <QDataStream>
+
 #include "i51core.h"
 #include "simulator.h"
 #include "mcuport.h"
@@ -72,6 +74,57 @@ void I51Core::reset()
     m_readBusTime = 12*m_psStep-10; // PSEN 1, Read data Bus
 }
 
+bool I51Core::saveState( QDataStream& s )
+{
+    McuCpu::saveState( s );
+    s << (qint32)m_cycle << m_readExtPGM << (qint32)m_cpuState << m_tmpPC << m_pgmData << m_opcode;
+    s << m_dataEvent << m_addrMode << m_opAddr << m_op0 << m_op2 << m_RxAddr << m_bitAddr << m_bitMask << m_invert;
+    s << m_upperData << (qint32)m_memState << m_read << m_extPGM << m_addrH << m_addr << m_data << (quint64)m_dataTime;
+    return true;
+}
+
+bool I51Core::loadState( QDataStream& s, bool check )
+{
+    if( !McuCpu::loadState( s, check ) ) return false;
+
+    qint32 cycle, cpuState, memState;
+    bool readExtPGM, invert, upperData, read, extPGM;
+    uint16_t tmpPC, opAddr;
+    uint8_t pgmData, opcode, addrMode, op0, op2, rxAddr, bitAddr, bitMask, addrH;
+    uint32_t addr, data;
+    quint64 dataTime;
+    QVector<uint8_t> dataEvent;
+    s >> cycle >> readExtPGM >> cpuState >> tmpPC >> pgmData >> opcode;
+    s >> dataEvent >> addrMode >> opAddr >> op0 >> op2 >> rxAddr >> bitAddr >> bitMask >> invert;
+    s >> upperData >> memState >> read >> extPGM >> addrH >> addr >> data >> dataTime;
+    if( check || s.status() != QDataStream::Ok ) return s.status() == QDataStream::Ok;
+
+    m_cycle      = cycle;
+    m_readExtPGM = readExtPGM;
+    m_cpuState   = (cpuState_t)cpuState;
+    m_tmpPC      = tmpPC;
+    m_pgmData    = pgmData;
+    m_opcode     = opcode;
+    m_dataEvent  = dataEvent;
+    m_addrMode   = addrMode;
+    m_opAddr     = opAddr;
+    m_op0        = op0;
+    m_op2        = op2;
+    m_RxAddr     = rxAddr;
+    m_bitAddr    = bitAddr;
+    m_bitMask    = bitMask;
+    m_invert     = invert;
+    m_upperData  = upperData;
+    m_memState   = (memState_t)memState;
+    m_read       = read;
+    m_extPGM     = extPGM;
+    m_addrH      = addrH;
+    m_addr       = addr;
+    m_data       = data;
+    m_dataTime   = dataTime;
+    return true;
+}
+
 void I51Core::runEvent()
 {
     switch( m_memState ) {
@@ -63,6 +63,9 @@ class I51Core : public McuCpu, public eElement
 
         virtual void INTERRUPT( uint32_t addr ) override;
 
+        virtual bool saveState( QDataStream& s ) override;
+        virtual bool loadState( QDataStream& s, bool check ) override;
+
     protected:
 
         uint64_t m_psStep;  // Half Clock cycle ps = 1/24 Machine cycle, = 1/12 Read cycle.
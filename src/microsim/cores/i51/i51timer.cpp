@@ -3,6 +3,8 @@
  *                                                                         *
  ***( see copyright.txt file at root folder )*******************************/
 
+#include <QDataStream>
+
 #include "i51timer.h"
 #include "e_mcu.h"
 #include "mcupin.h"
@@ -153,6 +155,28 @@ void I51Timer::updtCount( uint8_t )     // Write counter values to Ram
     }
 }
 
+bool I51Timer::saveState( QDataStream& s )
+{
+    McuTimer::saveState( s );
+    s << m_gate << m_trEnabled;
+    return true;
+}
+
+bool I51Timer::loadState( QDataStream& s, bool check )
+{
+    if( !McuTimer::loadState( s, check ) ) return false;
+
+    bool gate, trEnabled;
+    s >> gate >> trEnabled;
+    if( check || s.status() != QDataStream::Ok ) return s.status() == QDataStream::Ok;
+
+    m_gate      = gate;
+    m_trEnabled = trEnabled;
+
+    m_gatePin->changeCallBack( this, m_gate );
+    return true;
+}
+
 void I51Timer::doUpdateEnable()
 {
     // getVoltage is only called when m_trEnabled is true and m_gate is true
@@ -24,6 +24,9 @@ class I51Timer : public McuTimer
         virtual void updtCycles() override;
         virtual void updtCount( uint8_t val=0 ) override;
 
+        virtual bool saveState( QDataStream& s ) override;
+        virtual bool loadState( QDataStream& s, bool check ) override;
+
     protected:
 
         virtual void doUpdateEnable();
@@ -3,6 +3,8 @@
  *                                                                         *
  ***( see copyright.txt file at root folder )*******************************/
 
+#include <QDataStream>
+
 #include "i51usart.h"
 #include "usarttx.h"
 #include "usartrx.h"
@@ -42,6 +44,32 @@ void I51Usart::reset()
     m_counter = 0;
 }
 
+bool I51Usart::saveState( QDataStream& s )
+{
+    McuUsart::saveState( s );
+    s << m_counter << m_smodVal << m_smodDiv << m_stopBitError;
+    return true;
+}
+
+bool I51Usart::loadState( QDataStream& s, bool check )
+{
+    if( !McuUsart::loadState( s, check ) ) return false;
+
+    int counter;
+    uint8_t smodVal;
+    bool smodDiv, stopBitError;
+    s >> counter >> smodVal >> smodDiv >> stopBitError;
+    if( check || s.status() != QDataStream::Ok ) return s.status() == QDataStream::Ok;
+
+    m_counter      = counter;
+    m_smodVal      = smodVal;
+    m_smodDiv      = smodDiv;
+    m_stopBitError = stopBitError;
+
+    m_timer1->getInterrupt()->callBack( this, m_mode == 1 || m_mode == 3 ); // Baudrate from Timer1
+    return true;
+}
+
 void I51Usart::configureA( uint8_t newSCON ) //SCON
 {
     uint8_t mode = getRegBitsVal( newSCON, m_SM );
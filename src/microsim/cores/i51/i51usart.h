@@ -28,6 +28,9 @@ class I51Usart : public McuUsart
 
         virtual void callBack() override; // Called by Timer 1 interrupt
 
+        virtual bool saveState( QDataStream& s ) override;
+        virtual bool loadState( QDataStream& s, bool check ) override;
+
     private:
         McuTimer* m_timer1;
 
@@ -4,6 +4,7 @@
  ***( see copyright.txt file at root folder )*******************************/
 
 #include <QDebug>
+#include <QDataStream>
 
 #include "mcs65core.h"
 #include "e_mcu.h"
@@ -88,6 +89,62 @@ void Mcs65Cpu::reset()
     stamp();
 }
 
+bool Mcs65Cpu::saveState( QDataStream& s )
+{
+    qint32 exec = 0;                                  // Instruction pointer can't be saved:
+    if     ( m_EXEC == &Mcs65Cpu::BRK ) exec = 1;     // BRK or Interrupt
+    else if( m_EXEC )                   exec = 2;     // Decoded from m_IR at load
+
+    s << m_PC << m_debugPC << m_nextClock << m_halt << (qint32)m_cycle << exec;
+    s << m_P << m_SP << m_Ac << m_IR << m_rX << m_rY << (qint32)m_state << (qint32)m_nextState;
+    s << m_IsrH << m_IsrL << (qint32)m_aMode << m_aFlags << m_u8Tmp0 << m_u8Tmp1 << m_op0;
+    s << m_opAddr << m_busAddr << (qint32)m_dataMode;
+    return true;
+}
+
+bool Mcs65Cpu::loadState( QDataStream& s, bool check )
+{
+    uint32_t pc, debugPC;
+    bool nextClock, halt;
+    qint32 cycle, exec, state, nextState, aMode, dataMode;
+    uint8_t P, SP, Ac, IR, rX, rY, isrH, isrL, aFlags, tmp0, tmp1, op0;
+    uint16_t opAddr, busAddr;
+    s >> pc >> debugPC >> nextClock >> halt >> cycle >> exec;
+    s >> P >> SP >> Ac >> IR >> rX >> rY >> state >> nextState;
+    s >> isrH >> isrL >> aMode >> aFlags >> tmp0 >> tmp1 >> op0;
+    s >> opAddr >> busAddr >> dataMode;
+    if( check || s.status() != QDataStream::Ok ) return s.status() == QDataStream::Ok;
+
+    m_IR = IR;
+    if     ( exec == 1 ) m_EXEC = &Mcs65Cpu::BRK;
+    else if( exec == 2 ) decode();                    // Set m_EXEC, other values overwritten below
+    else                 m_EXEC = NULL;
+
+    m_PC = pc;
+    m_debugPC = debugPC;
+    m_nextClock = nextClock;
+    m_halt  = halt;
+    m_cycle = cycle;
+    m_P  = P;
+    m_SP = SP;
+    m_Ac = Ac;
+    m_rX = rX;
+    m_rY = rY;
+    m_state     = (cpuState_t)state;
+    m_nextState = (cpuState_t)nextState;
+    m_IsrH   = isrH;
+    m_IsrL   = isrL;
+    m_aMode  = (addrMode_t)aMode;
+    m_aFlags = aFlags;
+    m_u8Tmp0 = tmp0;
+    m_u8Tmp1 = tmp1;
+    m_op0    = op0;
+    m_opAddr  = opAddr;
+    m_busAddr = busAddr;
+    m_dataMode = (pinMode_t)dataMode;
+    return true;
+}
+
 void Mcs65Cpu::stamp()
 {
     m_dataBus->reset();
@@ -37,6 +37,9 @@ class Mcs65Cpu : public Mcs65Interface
         virtual void runStep() override;
         virtual void extClock( bool clkState ) override;
 
+        virtual bool saveState( QDataStream& s ) override;
+        virtual bool loadState( QDataStream& s, bool check ) override;
+
         virtual uint getPC() override { return m_debugPC; }
 
         enum { C=0,Z,I,D,B,O,V,N }; // STATUS bits
@@ -3,6 +3,8 @@
  *                                                                         *
  ***( see copyright.txt file at root folder )*******************************/
 
+#include <QDataStream>
+
 #include "mcucpu.h"
 
 McuCpu::McuCpu( eMcu* mcu )
@@ -29,6 +31,23 @@ McuCpu::McuCpu( eMcu* mcu )
 }
 McuCpu::~McuCpu() {}
 
+bool McuCpu::saveState( QDataStream& s ) // Other registers are in Ram
+{
+    s << m_PC << m_RET_ADDR;
+    return true;
+}
+
+bool McuCpu::loadState( QDataStream& s, bool check )
+{
+    uint32_t pc, retAddr;
+    s >> pc >> retAddr;
+    if( check || s.status() != QDataStream::Ok ) return s.status() == QDataStream::Ok;
+
+    m_PC = pc;
+    m_RET_ADDR = retAddr;
+    return true;
+}
+
 void McuCpu::CALL_ADDR( uint32_t addr ) // Used by MCU Interrupts:: All MCUs should use or override this
 {
     PUSH_STACK( m_PC );
@@ -17,6 +17,9 @@ class McuCpu : public CpuBase
 
         virtual void CALL_ADDR( uint32_t addr ) override; // Used by MCU Interrupts:: All MCUs should use or override this
 
+        virtual bool saveState( QDataStream& s ) override;
+        virtual bool loadState( QDataStream& s, bool check ) override;
+
     protected:
         uint8_t*  m_dataMem;
         uint32_t  m_dataMemEnd;
@@ -3,6 +3,8 @@
  *                                                                         *
  ***( see copyright.txt file at root folder )*******************************/
 
+#include <QDataStream>
+
 #include "picadc.h"
 #include "picvref.h"
 #include "mcupin.h"
@@ -55,6 +57,25 @@ void PicAdc::configureA( uint8_t newADCON0 ) // ADCON0
     if( !m_converting && convert ) startConversion();
 }
 
+bool PicAdc::saveState( QDataStream& s )
+{
+    McuAdc::saveState( s );
+    s << m_mode;
+    return true;
+}
+
+bool PicAdc::loadState( QDataStream& s, bool check )
+{
+    if( !McuAdc::loadState( s, check ) ) return false;
+
+    uint8_t mode;
+    s >> mode;
+    if( check || s.status() != QDataStream::Ok ) return s.status() == QDataStream::Ok;
+
+    m_mode = mode;
+    return true;
+}
+
 void PicAdc::endConversion()
 {
     if( m_leftAdjust ) m_adcValue <<= 6;
@@ -31,6 +31,9 @@ class PicAdc : public McuAdc
 
         virtual void sleep( int mode ) override;
 
+        virtual bool saveState( QDataStream& s ) override;
+        virtual bool loadState( QDataStream& s, bool check ) override;
+
     protected:
         virtual void endConversion() override;
         void setAdcClock( uint8_t prs );
@@ -3,6 +3,8 @@
  *                                                                         *
  ***( see copyright.txt file at root folder )*******************************/
 
+#include <QDataStream>
+
 #include "picccpunit.h"
 #include "picicunit.h"
 #include "picocunit.h"
@@ -78,6 +80,27 @@ void PicCcpUnit::configureA( uint8_t CCPxCON ) //
     else                  { m_ccpMode = ccpPWM; m_pwmUnit->configure( CCPxCON );}// PWM Mode
 }
 
+bool PicCcpUnit::saveState( QDataStream& s )
+{
+    saveModule( s );
+    s << m_mode << (qint32)m_ccpMode;
+    return true;
+}
+
+bool PicCcpUnit::loadState( QDataStream& s, bool check )
+{
+    if( !loadModule( s, check ) ) return false;
+
+    uint8_t mode;
+    qint32 ccpMode;
+    s >> mode >> ccpMode;
+    if( check || s.status() != QDataStream::Ok ) return s.status() == QDataStream::Ok;
+
+    m_mode    = mode;
+    m_ccpMode = (ccpMode_t)ccpMode;
+    return true;
+}
+
 void PicCcpUnit::setInterrupt( Interrupt* i )
 {
     m_capUnit->m_interrupt = i;
@@ -40,6 +40,9 @@ class PicCcpUnit : public McuModule, public eElement
 
         void setPin( McuPin* pin );
 
+        virtual bool saveState( QDataStream& s ) override;
+        virtual bool loadState( QDataStream& s, bool check ) override;
+
     protected:
         uint8_t m_mode;
         ccpMode_t m_ccpMode;
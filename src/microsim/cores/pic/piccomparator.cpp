@@ -3,6 +3,8 @@
  *                                                                         *
  ***( see copyright.txt file at root folder )*******************************/
 
+#include <QDataStream>
+
 #include "piccomparator.h"
 #include "datautils.h"
 #include "e_mcu.h"
@@ -57,6 +59,25 @@ void PicComp::voltChanged()
     }
 }
 
+bool PicComp::saveState( QDataStream& s )
+{
+    McuComp::saveState( s );
+    s << m_inv;
+    return true;
+}
+
+bool PicComp::loadState( QDataStream& s, bool check )
+{
+    if( !McuComp::loadState( s, check ) ) return false;
+
+    bool inv;
+    s >> inv;
+    if( check || s.status() != QDataStream::Ok ) return s.status() == QDataStream::Ok;
+
+    m_inv = inv;
+    return true;
+}
+
 void PicComp::connect( McuPin* pinN, McuPin* pinP, McuPin* pinOut )
 {
     if( pinN != m_pinN )
@@ -92,6 +113,25 @@ PicComp0::PicComp0( eMcu* mcu, QString name )
 }
 PicComp0::~PicComp0(){}
 
+bool PicComp0::saveState( QDataStream& s )
+{
+    PicComp::saveState( s );
+    s << m_cis;
+    return true;
+}
+
+bool PicComp0::loadState( QDataStream& s, bool check )
+{
+    if( !PicComp::loadState( s, check ) ) return false;
+
+    bool cis;
+    s >> cis;
+    if( check || s.status() != QDataStream::Ok ) return s.status() == QDataStream::Ok;
+
+    m_cis = cis;
+    return true;
+}
+
 void PicComp0::configureA( uint8_t newCMCON )
 {
     m_cis = getRegBitsBool( newCMCON, m_CIS );
@@ -17,6 +17,9 @@ class PicComp : public McuComp
         virtual void initialize() override;
         virtual void voltChanged() override;
 
+        virtual bool saveState( QDataStream& s ) override;
+        virtual bool loadState( QDataStream& s, bool check ) override;
+
  static PicComp* createComparator( eMcu* mcu, QString name, int type );
 
     protected:
@@ -36,6 +39,9 @@ class PicComp0 : public PicComp
 
         virtual void configureA( uint8_t newCMCON ) override;
 
+        virtual bool saveState( QDataStream& s ) override;
+        virtual bool loadState( QDataStream& s, bool check ) override;
+
     protected:
         bool m_cis;
 
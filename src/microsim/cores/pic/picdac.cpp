@@ -4,6 +4,7 @@
  ***( see copyright.txt file at root folder )*******************************/
 
 #include <QDebug>
+#include <QDataStream>
 
 #include "picdac.h"
 #include "e_mcu.h"
@@ -85,6 +86,32 @@ void PicDac::configureA( uint8_t newDACCON0 ) //
     voltChanged();
 }
 
+bool PicDac::saveState( QDataStream& s )
+{
+    McuDac::saveState( s );
+    s << m_useFVR << m_usePinP << m_usePinN << m_daclps;
+    return true;
+}
+
+bool PicDac::loadState( QDataStream& s, bool check )
+{
+    if( !McuDac::loadState( s, check ) ) return false;
+
+    bool useFVR, usePinP, usePinN;
+    uint8_t daclps;
+    s >> useFVR >> usePinP >> usePinN >> daclps;
+    if( check || s.status() != QDataStream::Ok ) return s.status() == QDataStream::Ok;
+
+    m_useFVR  = useFVR;
+    m_usePinP = usePinP;
+    m_usePinN = usePinN;
+    m_daclps  = daclps;
+
+    if( m_pRefPin ) m_pRefPin->changeCallBack( this, m_usePinP );
+    if( m_nRefPin ) m_nRefPin->changeCallBack( this, m_usePinN );
+    return true;
+}
+
 void PicDac::outRegChanged( uint8_t val ) // DACON1 is written
 {
     m_outVal = getRegBitsVal( val, m_DACR );
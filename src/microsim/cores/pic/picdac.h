@@ -28,6 +28,9 @@ class PicDac:  public McuDac
 
         virtual void callBack() override;
 
+        virtual bool saveState( QDataStream& s ) override;
+        virtual bool loadState( QDataStream& s, bool check ) override;
+
     protected:
         void updtOutVolt();
 
@@ -3,6 +3,8 @@
  *                                                                         *
  ***( see copyright.txt file at root folder )*******************************/
 
+#include <QDataStream>
+
 #include "piceeprom.h"
 #include "datautils.h"
 #include "e_mcu.h"
@@ -34,6 +36,29 @@ void PicEeprom::runEvent() // Write cycle end reached
     m_wrMask = 0;
 }
 
+bool PicEeprom::saveState( QDataStream& s )
+{
+    McuEeprom::saveState( s );
+    s << (quint64)m_nextCycle << m_writeEnable << m_wrMask;
+    return true;
+}
+
+bool PicEeprom::loadState( QDataStream& s, bool check )
+{
+    if( !McuEeprom::loadState( s, check ) ) return false;
+
+    quint64 nextCycle;
+    bool writeEnable;
+    uint8_t wrMask;
+    s >> nextCycle >> writeEnable >> wrMask;
+    if( check || s.status() != QDataStream::Ok ) return s.status() == QDataStream::Ok;
+
+    m_nextCycle   = nextCycle;
+    m_writeEnable = writeEnable;
+    m_wrMask      = wrMask;
+    return true;
+}
+
 void PicEeprom::configureA( uint8_t newEECON1 ) // EECR is being written
 {
     if( m_writeEnable ) // Write enabled
@@ -3,6 +3,8 @@
  *                                                                         *
  ***( see copyright.txt file at root folder )*******************************/
 
+#include <QDataStream>
+
 #include "picicunit.h"
 #include "datautils.h"
 #include "mcupin.h"
@@ -41,3 +43,23 @@ void PicIcUnit::configure( uint8_t CCPxM ) // CCPxM0,CCPxM1,CCPxM2,CCPxM3
         case 3: m_prescaler = 16;            // Rising Edge, Presc = 16
     }
 }
+
+bool PicIcUnit::saveState( QDataStream& s )
+{
+    McuIcUnit::saveState( s );
+    s << (quint64)m_prescaler << (quint64)m_counter;
+    return true;
+}
+
+bool PicIcUnit::loadState( QDataStream& s, bool check )
+{
+    if( !McuIcUnit::loadState( s, check ) ) return false;
+
+    quint64 prescaler, counter;
+    s >> prescaler >> counter;
+    if( check || s.status() != QDataStream::Ok ) return s.status() == QDataStream::Ok;
+
+    m_prescaler = prescaler;
+    m_counter   = counter;
+    return true;
+}
@@ -22,6 +22,9 @@ class PicIcUnit : public McuIcUnit
 
         virtual void configure( uint8_t CCPxM ) override;
 
+        virtual bool saveState( QDataStream& s ) override;
+        virtual bool loadState( QDataStream& s, bool check ) override;
+
     private:
         uint64_t m_prescaler;
         uint64_t m_counter;
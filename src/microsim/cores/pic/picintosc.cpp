@@ -3,6 +3,8 @@
  *                                                                         *
  ***( see copyright.txt file at root folder )*******************************/
 
+#include <QDataStream>
+
 #include "picintosc.h"
 #include "datautils.h"
 #include "simulator.h"
@@ -36,6 +38,25 @@ void PicIntOsc::stamp()
     if( m_cfgWordCtrl ) McuIntOsc::stamp();
 }
 
+bool PicIntOsc::saveState( QDataStream& s )
+{
+    McuIntOsc::saveState( s );
+    s << m_cfgWordCtrl;
+    return true;
+}
+
+bool PicIntOsc::loadState( QDataStream& s, bool check )
+{
+    if( !McuIntOsc::loadState( s, check ) ) return false;
+
+    bool cfgWordCtrl;
+    s >> cfgWordCtrl;
+    if( check || s.status() != QDataStream::Ok ) return s.status() == QDataStream::Ok;
+
+    m_cfgWordCtrl = cfgWordCtrl;
+    return true;
+}
+
 void PicIntOsc::setPin( int n, McuPin* p )
 {
     if     ( n == 0 ) m_clkOutPin = m_clkPin[0] = p; // RA6 16F886
@@ -18,6 +18,9 @@ class PicIntOsc : public McuIntOsc
 
         virtual void setPin( int n, McuPin* p ) override;
 
+        virtual bool saveState( QDataStream& s ) override;
+        virtual bool loadState( QDataStream& s, bool check ) override;
+
  static PicIntOsc* createIntOsc( eMcu* mcu, QString name, QString type );
 
     protected:
@@ -3,6 +3,8 @@
  *                                                                         *
  ***( see copyright.txt file at root folder )*******************************/
 
+#include <QDataStream>
+
 #include "picmrcore.h"
 #include "datautils.h"
 #include "regwatcher.h"
@@ -25,6 +27,33 @@ void PicMrCore::reset()
     *m_Wreg = 0;
 }
 
+bool PicMrCore::saveState( QDataStream& s ) // Hardware Stack and W register (hidden in Pic14)
+{
+    McuCpu::saveState( s );
+    for( uint32_t addr : m_stack ) s << addr;
+    s << m_sp << m_bank << *m_Wreg;
+    return true;
+}
+
+bool PicMrCore::loadState( QDataStream& s, bool check )
+{
+    if( !McuCpu::loadState( s, check ) ) return false;
+
+    uint32_t stack[8];
+    uint8_t sp, wReg;
+    uint16_t bank;
+    for( uint32_t& addr : stack ) s >> addr;
+    s >> sp >> bank >> wReg;
+    if( s.status() != QDataStream::Ok || sp >= 8 ) return false;
+    if( check ) return true;
+
+    for( int i=0; i<8; ++i ) m_stack[i] = stack[i];
+    m_sp   = sp;
+    m_bank = bank;
+    *m_Wreg = wReg;
+    return true;
+}
+
 void PicMrCore::setBank( uint8_t bank )
 {
     m_bank = getRegBitsVal( bank, m_bankBits );
@@ -23,6 +23,9 @@ class PicMrCore : public McuCpu
 
         virtual uint RET_ADDR() override { return m_stack[m_sp]; }
 
+        virtual bool saveState( QDataStream& s ) override;
+        virtual bool loadState( QDataStream& s, bool check ) override;
+
     protected:
         virtual void runStep( uint16_t instr );
         uint8_t* m_Wreg;
@@ -3,6 +3,8 @@
  *                                                                         *
  ***( see copyright.txt file at root folder )*******************************/
 
+#include <QDataStream>
+
 #include "picmssp.h"
 #include "picspi.h"
 #include "pictwi.h"
@@ -24,6 +26,27 @@ void PicMssp::initialize()
     m_enabled = false;
 }
 
+bool PicMssp::saveState( QDataStream& s )
+{
+    saveModule( s );
+    s << m_mode << m_enabled;
+    return true;
+}
+
+bool PicMssp::loadState( QDataStream& s, bool check ) // SPI and TWI units restore their own state
+{
+    if( !loadModule( s, check ) ) return false;
+
+    uint8_t mode;
+    bool enabled;
+    s >> mode >> enabled;
+    if( check || s.status() != QDataStream::Ok ) return s.status() == QDataStream::Ok;
+
+    m_mode    = mode;
+    m_enabled = enabled;
+    return true;
+}
+
 void PicMssp::configureA( uint8_t SSPCON )
 {
     bool enabled = getRegBitsBool( SSPCON, m_SSPEN );
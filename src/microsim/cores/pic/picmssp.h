@@ -23,6 +23,9 @@ class PicMssp : public McuModule, public eElement
 
         virtual void initialize() override;
 
+        virtual bool saveState( QDataStream& s ) override;
+        virtual bool loadState( QDataStream& s, bool check ) override;
+
         virtual void configureA( uint8_t SSPCON ) override;
 
         //virtual void setInterrupt( Interrupt* i ) override;
@@ -3,6 +3,8 @@
  *                                                                         *
  ***( see copyright.txt file at root folder )*******************************/
 
+#include <QDataStream>
+
 #include "picocunit.h"
 #include "datautils.h"
 #include "mcupin.h"
@@ -78,6 +80,26 @@ void PicOcUnit::ocrWriteH( uint8_t val )
     if( m_enabled ) sheduleEvents( m_timer->ovfMatch(), m_timer->getCount() );
 }
 
+bool PicOcUnit::saveState( QDataStream& s )
+{
+    McuOcUnit::saveState( s );
+    s << m_specEvent << m_resetTimer;
+    return true;
+}
+
+bool PicOcUnit::loadState( QDataStream& s, bool check )
+{
+    if( !McuOcUnit::loadState( s, check ) ) return false;
+
+    bool specEvent, resetTimer;
+    s >> specEvent >> resetTimer;
+    if( check || s.status() != QDataStream::Ok ) return s.status() == QDataStream::Ok;
+
+    m_specEvent  = specEvent;
+    m_resetTimer = resetTimer;
+    return true;
+}
+
 //------------------------------------------------------
 //-- PIC PWM Unit --------------------------------------
 
@@ -141,6 +163,26 @@ void PicPwmUnit::ocrWriteL( uint8_t val ) // CCPRxL
     sheduleEvents( m_timer->ovfMatch(), m_timer->getCount() );
 }
 
+bool PicPwmUnit::saveState( QDataStream& s )
+{
+    McuOcUnit::saveState( s );
+    s << m_cLow << m_CCPRxL;
+    return true;
+}
+
+bool PicPwmUnit::loadState( QDataStream& s, bool check )
+{
+    if( !McuOcUnit::loadState( s, check ) ) return false;
+
+    uint8_t cLow, CCPRxL;
+    s >> cLow >> CCPRxL;
+    if( check || s.status() != QDataStream::Ok ) return s.status() == QDataStream::Ok;
+
+    m_cLow   = cLow;
+    m_CCPRxL = CCPRxL;
+    return true;
+}
+
 //------------------------------------------------------
 //-- PIC 16f88x PWM Unit -------------------------------
 
@@ -3,6 +3,8 @@
  *                                                                         *
  ***( see copyright.txt file at root folder )*******************************/
 
+#include <QDataStream>
+
 #include "picspi.h"
 #include "datautils.h"
 #include "iopin.h"
@@ -58,6 +60,26 @@ void PicSpi::setMode( spiMode_t mode )
     }
 }
 
+bool PicSpi::saveState( QDataStream& s )
+{
+    McuSpi::saveState( s );
+    s << m_clkPol << m_clkPha;
+    return true;
+}
+
+bool PicSpi::loadState( QDataStream& s, bool check )
+{
+    if( !McuSpi::loadState( s, check ) ) return false;
+
+    bool clkPol, clkPha;
+    s >> clkPol >> clkPha;
+    if( check || s.status() != QDataStream::Ok ) return s.status() == QDataStream::Ok;
+
+    m_clkPol = clkPol;
+    m_clkPha = clkPha;
+    return true;
+}
+
 void PicSpi::configureA( uint8_t newSSPCON ) // SSPCON is being written
 {
     m_clkPol = getRegBitsBool( newSSPCON, m_CKP ); // Clock polarity
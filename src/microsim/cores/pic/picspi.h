@@ -27,6 +27,9 @@ class PicSpi : public McuSpi
         virtual void endTransaction() override;
         virtual void sleep( int mode ) override;
 
+        virtual bool saveState( QDataStream& s ) override;
+        virtual bool loadState( QDataStream& s, bool check ) override;
+
     protected:
 
         bool m_clkPol;
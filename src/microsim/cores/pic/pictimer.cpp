@@ -3,6 +3,8 @@
  *                                                                         *
  ***( see copyright.txt file at root folder )*******************************/
 
+#include <QDataStream>
+
 #include "pictimer.h"
 #include "e_mcu.h"
 #include "simulator.h"
@@ -206,6 +208,27 @@ void PicTimer16bit::sleep( int mode )
     McuTimer::sleep( mode );
 }
 
+bool PicTimer16bit::saveState( QDataStream& s )
+{
+    McuTimer::saveState( s );
+    s << m_t1Osc << m_t1sync;
+    return true;
+}
+
+bool PicTimer16bit::loadState( QDataStream& s, bool check )
+{
+    if( !McuTimer::loadState( s, check ) ) return false;
+
+    bool t1Osc;
+    uint8_t t1sync;
+    s >> t1Osc >> t1sync;
+    if( check || s.status() != QDataStream::Ok ) return s.status() == QDataStream::Ok;
+
+    m_t1Osc  = t1Osc;
+    m_t1sync = t1sync;
+    return true;
+}
+
 //--------------------------------------------------
 // TIMER 1 -----------------------------------------
 
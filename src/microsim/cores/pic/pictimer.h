@@ -82,6 +82,9 @@ class PicTimer16bit : public PicTimer
 
         virtual void sleep( int mode ) override;
 
+        virtual bool saveState( QDataStream& s ) override;
+        virtual bool loadState( QDataStream& s, bool check ) override;
+
     protected:
         virtual void configureClock(){;}
         virtual void sheduleEvents() override;
@@ -3,6 +3,8 @@
  *                                                                         *
  ***( see copyright.txt file at root folder )*******************************/
 
+#include <QDataStream>
+
 #include "picusart.h"
 #include "usarttx.h"
 #include "usartrx.h"
@@ -102,6 +104,26 @@ void PicUsart::configureB( uint8_t newRCSTA ) // RCSTA changed
     m_receiver->ignoreData( adden );
 }
 
+bool PicUsart::saveState( QDataStream& s )
+{
+    McuUsart::saveState( s );
+    s << m_enabled << m_speedx2;
+    return true;
+}
+
+bool PicUsart::loadState( QDataStream& s, bool check )
+{
+    if( !McuUsart::loadState( s, check ) ) return false;
+
+    bool enabled, speedx2;
+    s >> enabled >> speedx2;
+    if( check || s.status() != QDataStream::Ok ) return s.status() == QDataStream::Ok;
+
+    m_enabled = enabled;
+    m_speedx2 = speedx2;
+    return true;
+}
+
 void PicUsart::setSPBRGL(  uint8_t val )
 {
     *m_SPBRGL = val;
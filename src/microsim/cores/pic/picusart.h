@@ -32,6 +32,9 @@ class PicUsart : public McuUsart
 
         virtual void sleep( int mode ) override;
 
+        virtual bool saveState( QDataStream& s ) override;
+        virtual bool loadState( QDataStream& s, bool check ) override;
+
     private:
         bool m_enabled;
 
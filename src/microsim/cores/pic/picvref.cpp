@@ -3,6 +3,8 @@
  *                                                                         *
  ***( see copyright.txt file at root folder )*******************************/
 
+#include <QDataStream>
+
 #include "picvref.h"
 #include "datautils.h"
 #include "e_mcu.h"
@@ -66,6 +68,26 @@ void PicVref::configureA( uint8_t newVRCON )
     m_mode = mode;
 }*/
 
+bool PicVref::saveState( QDataStream& s )
+{
+    McuVref::saveState( s );
+    s << m_vrr << m_vroe;
+    return true;
+}
+
+bool PicVref::loadState( QDataStream& s, bool check )
+{
+    if( !McuVref::loadState( s, check ) ) return false;
+
+    bool vrr, vroe;
+    s >> vrr >> vroe;
+    if( check || s.status() != QDataStream::Ok ) return s.status() == QDataStream::Ok;
+
+    m_vrr  = vrr;
+    m_vroe = vroe;
+    return true;
+}
+
 //-------------------------------------------------------------
 // Type 0: 16f1826 FVR  ---------------------------------------
 
@@ -105,6 +127,26 @@ void PicVrefE::configureA( uint8_t newFVRCON )
     { for( McuModule* mod : m_callBacks ) mod->callBack(); }
 }
 
+bool PicVrefE::saveState( QDataStream& s )
+{
+    McuVref::saveState( s );
+    s << m_adcVref << m_dacVref;
+    return true;
+}
+
+bool PicVrefE::loadState( QDataStream& s, bool check )
+{
+    if( !McuVref::loadState( s, check ) ) return false;
+
+    double adcVref, dacVref;
+    s >> adcVref >> dacVref;
+    if( check || s.status() != QDataStream::Ok ) return s.status() == QDataStream::Ok;
+
+    m_adcVref = adcVref;
+    m_dacVref = dacVref;
+    return true;
+}
+
 double PicVrefE::getAdcVref()
 {
     if( m_enabled ) return m_adcVref;
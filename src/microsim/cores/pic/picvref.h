@@ -18,6 +18,9 @@ class PicVref : public McuVref
 
         virtual void configureA( uint8_t newVRCON ) override;
 
+        virtual bool saveState( QDataStream& s ) override;
+        virtual bool loadState( QDataStream& s, bool check ) override;
+
     protected:
         //virtual void setMode( uint8_t mode ) override;
 
@@ -38,6 +41,9 @@ class PicVrefE : public McuVref
 
         virtual void configureA( uint8_t newFVRCON ) override;
 
+        virtual bool saveState( QDataStream& s ) override;
+        virtual bool loadState( QDataStream& s, bool check ) override;
+
         double getAdcVref();
         double getDacVref();
 
@@ -19,6 +19,7 @@ Display::Display( uint w, uint h, QString name, QWidget* parent )
 
     m_background= 0;
     m_changed = false;
+    m_dirty   = false;
 
     updtImageSize();
 }
@@ -39,6 +40,8 @@ void Display::updateStep()
         m_changed = false;
         updtImageSize();
     }
+    if( !m_dirty ) return;
+    m_dirty = false;
     update();
 }
 
@@ -103,25 +106,20 @@ void Display::setBackground( int b )
     setPixel( m_x, m_y, color );
 }*/
 
-void Display::setPixel( uint x, uint y, int color )
-{
-    if( x >= m_width || y >= m_height ) return;
-    m_data[x][y] = color;
-}
-
 void Display::updtImageSize()
 {
-    m_data.resize( 0, std::vector<int>(0) );
-    m_data.resize( m_width, std::vector<int>(m_height, m_background) );
+    m_image = QImage( m_width, m_height, QImage::Format_RGB32 );
+    m_image.fill( 0xFF000000 | m_background );
+    m_pixels    = (QRgb*)m_image.bits();
+    m_imgWidth  = m_width;
+    m_imgHeight = m_height;
+    m_dirty = true;
     this->setFixedSize( m_width*m_scale, m_height*m_scale );
 }
 
 void Display::paintEvent( QPaintEvent* )
 {
     QPainter p(this);
-
-    for( uint x=0; x<m_width; x++ )
-        for( uint y=0; y<m_height; y++ )
-            p.fillRect( QRectF( x*m_scale, y*m_scale, m_scale, m_scale ), QColor(m_data[x][y]) );
+    p.drawImage( QRectF( 0, 0, m_imgWidth*m_scale, m_imgHeight*m_scale ), m_image );
 }
 
@@ -7,6 +7,7 @@
 #define DISPLAY_H
 
 #include <QWidget>
+#include <QImage>
 
 #include "updatable.h"
 #include "e-element.h"
@@ -26,7 +27,12 @@ class Display : public QWidget, public Updatable, public eElement
         void setHeight( uint h );
         void setSize( uint w, uint h );
         void setBackground( int b );
-        void setPixel( uint x, uint y, int color );
+        inline void setPixel( uint x, uint y, int color ) // Write directly to framebuffer
+        {
+            if( x >= m_imgWidth || y >= m_imgHeight ) return;
+            m_pixels[y*m_imgWidth+x] = 0xFF000000 | color;
+            m_dirty = true;
+        }
 
         //void setNextPixel( int color );
         //void setLine( std::vector<int> line );
@@ -34,7 +40,7 @@ class Display : public QWidget, public Updatable, public eElement
 
         void setMonitorScale( double scale );
 
-        std::vector<std::vector<int>>* getBackData() { return &m_data; }
+        QImage* getBackData() { return &m_image; }
 
     protected:
         virtual void paintEvent( QPaintEvent* e ) override;
@@ -42,6 +48,7 @@ class Display : public QWidget, public Updatable, public eElement
         void updtImageSize();
 
         bool m_changed;
+        bool m_dirty;
 
         uint m_width;
         uint m_height;
@@ -53,7 +60,10 @@ class Display : public QWidget, public Updatable, public eElement
 
         int m_background;
 
-        std::vector<std::vector<int>> m_data;
+        QImage m_image;     // Persistent framebuffer
+        QRgb*  m_pixels;    // Raw access to m_image data, no detach
+        uint   m_imgWidth;
+        uint   m_imgHeight;
         QRectF  m_area;
 };
 
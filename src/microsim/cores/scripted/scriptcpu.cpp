@@ -459,7 +459,7 @@ void ScriptCpu::cancelEvents()        { Simulator::self()->cancelEvents( this );
 uint64_t ScriptCpu::circTime()        { return Simulator::self()->circTime(); }
 
 int  ScriptCpu::readPGM( uint addr )         { if( addr < m_progSize       ) return m_progMem[addr] & m_progWordMask ; return -1; }
-void ScriptCpu::writePGM( uint addr, int v ) { if( addr < m_progSize       ) m_progMem[addr] = v & m_progWordMask; }
+void ScriptCpu::writePGM( uint addr, int v ) { if( addr < m_progSize       ) m_mcu->setFlashValue( addr, v & m_progWordMask ); }
 int  ScriptCpu::readRAM( uint addr )         { if( addr <= m_dataMemEnd    ) return m_dataMem[addr]; return -1; }
 void ScriptCpu::writeRAM( uint addr, int v ) { SET_RAM( addr, v ); }
 int  ScriptCpu::readROM( uint addr )         { if( addr < m_mcu->romSize() ) return m_mcu->getRomValue( addr ); return -1; }
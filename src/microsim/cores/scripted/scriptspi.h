@@ -22,6 +22,7 @@ class ScriptSpi : public McuSpi, public ScriptPerif
         void sendByte( uint8_t data );
 
         virtual void reset() override;
+        virtual bool saveState( QDataStream& ) override { return false; } // State not supported yet
 
         virtual void endTransaction() override;
 
@@ -18,6 +18,7 @@ class ScriptTwi : public McuTwi, public ScriptPerif
         ~ScriptTwi();
 
         virtual void reset() override;
+        virtual bool saveState( QDataStream& ) override { return false; } // State not supported yet
 
         void setAddress( uint8_t a );
 
@@ -20,6 +20,7 @@ class ScriptUsart : public McuUsart, public ScriptPerif
         ~ScriptUsart();
 
         virtual void reset() override;
+        virtual bool saveState( QDataStream& ) override { return false; } // State not supported yet
         virtual void byteReceived( uint8_t data ) override;
         virtual void frameSent( uint8_t data ) override;
 
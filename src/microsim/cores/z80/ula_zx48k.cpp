@@ -62,6 +62,8 @@ ULA_ZX48k::ULA_ZX48k( eMcu* mcu )
 
     m_enumNames = m_enumUids;
 
+    m_screenChanged = true;
+
     mcu->createWatcher( this );
     Watcher* watcher = mcu->getWatcher();
 
@@ -187,6 +189,7 @@ void ULA_ZX48k::setScreen( bool s )
 {
     if( m_isSrceen == s ) return;
     m_isSrceen = s;
+    m_screenChanged = true;
 
     if( s ) m_display->setSize( 320, 240 ); // setOffset( 32+32, 60+2 );
     else    m_display->setSize( 448, 312 ); // setOffset( 0, 0 );
@@ -197,6 +200,9 @@ void ULA_ZX48k::updateStep()
     if( !m_display ) return;
 
     if( m_isSrceen ){                     // 320x240 screen, no beam
+        if( !m_screenChanged ) return;    // Nothing new to draw
+        m_screenChanged = false;
+
         for( int x=0; x<448; x++ )
         {
             int sx = x + 19;
@@ -211,6 +217,7 @@ void ULA_ZX48k::updateStep()
             }
         }
     }else{                               // Video memory with beam
+        m_screenChanged = false;
         for( int x=0; x<448; x++ )
             for( int y=0; y<312; y++ )
                 m_display->setPixel( x, y, m_colours[ m_screen[x][y] & 0x0f ] );
@@ -252,6 +259,7 @@ void ULA_ZX48k::stamp()
 
     m_borderColour = 0;
     m_evenScanLine = false;
+    m_screenChanged = true;
 
     m_a14Pin->setPinMode( input );
     m_a14Pin->changeCallBack( this );
@@ -477,7 +485,11 @@ void ULA_ZX48k::updateVideo()
     else FlBrGRB = ( m_shiftReg & 0x80 ) ? m_attrOutLatchInk : m_attrOutLatchPaper;// Colour Ink or Paper (Figure 12-6 and Figure 12-10)
     FlBrGRB |= m_attrOutLatchFlBr;                                      // Add bright and flash to video signals (Figure 12-10)
     m_shiftReg <<= 1;                                                   // Shift shift register one bit left (Figure 12-2 and Figure 12-7)
-    m_screen[m_C][m_V] = FlBrGRB;                                       // Store pixel color into screen
+    if( m_screen[m_C][m_V] != FlBrGRB )
+    {
+        m_screen[m_C][m_V] = FlBrGRB;                                   // Store pixel color into screen
+        m_screenChanged = true;
+    }
 
     m_yPin->setVoltage( ( hSync || vSync ) ? 4.3 : m_yTable[FlBrGRB & 0x0f] ); // Set luminance output Y (Table 16-1)
     if( m_type == ula6c011e ) {
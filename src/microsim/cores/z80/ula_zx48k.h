@@ -86,6 +86,7 @@ class ULA_ZX48k : public CpuBase, public eElement
         uint8_t m_attrOutLatchFlBr;
         uint8_t m_borderColour;
         uint8_t m_screen[448][312];
+        bool m_screenChanged;        // Any pixel changed since last updateStep
         bool m_evenScanLine;
         static const float m_yTable[16];
         static const float m_uTable[8];
@@ -17,7 +17,10 @@
  *                                                                         *
  ***************************************************************************/
 
+#include <QDataStream>
+
 #include "z80core.h"
+#include "memory.h"
 #include "z80cycles.h"
 #include "mcupin.h"
 #include "simulator.h"
@@ -89,6 +92,12 @@ Z80Core::Z80Core( eMcu* mcu )
 
     m_delay = 10e3; // 10 ns
 
+    m_busMem = NULL;
+    m_fastExec = false;
+    m_instMode = false;
+    m_slowEdge = false;
+    m_edgeTime = 0;
+
     m_dataPort = mcu->getIoPort("PORTD");
     m_addrPort = mcu->getIoPort("PORTA");
 
@@ -119,6 +128,7 @@ new StrProp <Z80Core>( "Producer"        , QObject::tr("Producer")             ,
 new BoolProp<Z80Core>( "CMOS"            , QObject::tr("CMOS")                 , "", this, &Z80Core::cmos     , &Z80Core::setCmos ),
 new BoolProp<Z80Core>( "Single cycle I/O", QObject::tr("Single cycle I/O")     , "", this, &Z80Core::ioWait   , &Z80Core::setIoWait ),
 new BoolProp<Z80Core>( "Int_Vector"      , QObject::tr("Interrupt Vector 0xFF"), "", this, &Z80Core::intVector, &Z80Core::setIntVector ),
+new BoolProp<Z80Core>( "Fast_Exec"       , QObject::tr("Fast execution")       , "", this, &Z80Core::fastExec , &Z80Core::setFastExec ),
     },0} );
 }
 
@@ -473,6 +483,15 @@ void Z80Core::stamp()
     m_busacPin->setPinMode( output );
     m_busacPin->setOutStatFast( true );
 
+    m_busMem = Memory::busMemory( m_addrPort, m_dataPort, m_mreqPin, m_rdPin, m_wrPin );
+
+    // Fast execution: memory cycles without delayed bus events and, with internal clock,
+    // whole instructions per step; only if no external hardware is watching or stretching the bus cycles
+    m_instMode = m_fastExec && m_busMem
+              && !m_m1Pin->isConnected()   && !m_rfshPin->isConnected()
+              && !m_haltPin->isConnected() && !m_busacPin->isConnected()
+              && !m_waitPin->isConnected() && !m_busreqPin->isConnected();
+
     // ?? followed four lines must be in stamp(), it defines reset behaviour and must not be reset in reset() method
     normalReset = false;                /// reset flag normalReset
     specialReset = false;               /// reset flag specialReset
@@ -480,6 +499,100 @@ void Z80Core::stamp()
     m_nextClock = true; /// ???
 }
 
+bool Z80Core::saveState( QDataStream& s )
+{
+    s << m_PC << m_RET_ADDR;
+    for( uint8_t reg : regs    ) s << reg;
+    for( uint8_t reg : regsAlt ) s << reg;
+    s << regA << (uint8_t)regF << regAAlt << regFAlt << regI << regR << (uint16_t)regWZ << (uint16_t)regSP << IFF1 << IFF2;
+
+    // MCode and main state machine
+    s << mc_TStates << mc_MCycles << (qint32)mc_StateMachine << (qint32)mc_prefix << (qint32)mc_busOp << (qint32)m_lastBusOp;
+    s << (qint32)m_iSet << (qint32)XYState << m_iReg << intMode << rstCount << normalReset << specialReset;
+    s << sm_TState << sm_lastTState << sm_TStatesAfterInt << sm_MCycle << sm_PreXYMCycle << (qint32)sm_M1CycleType;
+    s << sm_autoWait << sm_waitTState;
+
+    // Bus
+    s << sWait << sBusReq << sBusAck << NMIFF << sLastNMI << sNMI << sInt << sDI << sDO << sAO;
+    s << m_nextClock << highImpedanceBus;
+    return true;
+}
+
+bool Z80Core::loadState( QDataStream& s, bool check )
+{
+    uint32_t pc, retAddr;
+    uint8_t rgs[10], rgsAlt[6], rA, rF, rAAlt, rFAlt, rI, rR, iReg, iMode, rstCnt;
+    uint8_t tStates, mCycles, tState, mCycle, preXYMCycle, autoWait, dI, dO;
+    uint16_t rWZ, rSP, aO;
+    uint32_t tStatesAfterInt;
+    qint32 stateMachine, prefix, busOp, lastBusOp, iSet, xyState, m1CycleType;
+    bool iff1, iff2, nReset, sReset, lastTState, waitTState;
+    bool wait, busReq, busAck, nmiFF, lastNMI, nmi, inte, nextClock, highImp;
+
+    s >> pc >> retAddr;
+    for( uint8_t& reg : rgs    ) s >> reg;
+    for( uint8_t& reg : rgsAlt ) s >> reg;
+    s >> rA >> rF >> rAAlt >> rFAlt >> rI >> rR >> rWZ >> rSP >> iff1 >> iff2;
+    s >> tStates >> mCycles >> stateMachine >> prefix >> busOp >> lastBusOp;
+    s >> iSet >> xyState >> iReg >> iMode >> rstCnt >> nReset >> sReset;
+    s >> tState >> lastTState >> tStatesAfterInt >> mCycle >> preXYMCycle >> m1CycleType;
+    s >> autoWait >> waitTState;
+    s >> wait >> busReq >> busAck >> nmiFF >> lastNMI >> nmi >> inte >> dI >> dO >> aO;
+    s >> nextClock >> highImp;
+    if( check || s.status() != QDataStream::Ok ) return s.status() == QDataStream::Ok;
+
+    m_PC = pc;
+    m_RET_ADDR = retAddr;
+    for( int i=0; i<10; ++i ) regs[i] = rgs[i];
+    for( int i=0; i<6; ++i ) regsAlt[i] = rgsAlt[i];
+    regA = rA;
+    regF = rF;
+    regAAlt = rAAlt;
+    regFAlt = rFAlt;
+    regI = rI;
+    regR = rR;
+    regWZ = rWZ;
+    regSP = rSP;
+    IFF1 = iff1;
+    IFF2 = iff2;
+
+    mc_TStates = tStates;
+    mc_MCycles = mCycles;
+    mc_StateMachine = (eStateMachine)stateMachine;
+    mc_prefix = (ePrefix)prefix;
+    mc_busOp  = (eBusOperation)busOp;
+    m_lastBusOp = (eBusOperation)lastBusOp;
+    m_iSet  = (ePrefix)iSet;
+    XYState = (eRegPairs)xyState;
+    m_iReg  = iReg;
+    intMode = iMode;
+    rstCount = rstCnt;
+    normalReset  = nReset;
+    specialReset = sReset;
+    sm_TState = tState;
+    sm_lastTState = lastTState;
+    sm_TStatesAfterInt = tStatesAfterInt;
+    sm_MCycle = mCycle;
+    sm_PreXYMCycle = preXYMCycle;
+    sm_M1CycleType = (eM1CycleType)m1CycleType;
+    sm_autoWait   = autoWait;
+    sm_waitTState = waitTState;
+
+    sWait   = wait;
+    sBusReq = busReq;
+    sBusAck = busAck;
+    NMIFF   = nmiFF;
+    sLastNMI = lastNMI;
+    sNMI = nmi;
+    sInt = inte;
+    sDI  = dI;
+    sDO  = dO;
+    sAO  = aO;
+    m_nextClock = nextClock;
+    highImpedanceBus = highImp;
+    return true;
+}
+
 void Z80Core::runEvent()
 {
     if( m_nextClock ) fallingEdgeDelayed(); // Falling edge
@@ -547,16 +660,46 @@ void Z80Core::reset()
 
 void Z80Core::extClock( bool clkState ) // External Clock
 {
-    if( clkState == m_nextClock ) runStep();
+    if( clkState == m_nextClock ) clockEdge();
 }
 
-void Z80Core::runStep()
+void Z80Core::runStep() // Internal Clock: one clock edge per tick
+{
+    if( !m_instMode )
+    {
+        clockEdge();
+        m_mcu->cyclesDone = 1;
+        return;
+    }
+    // Fast execution: run all clock edges of one instruction in this step
+    // Stop when next instruction starts or an edge needs a delayed event to drive Pins
+    int edges = 0;
+    m_edgeTime = 0;
+    m_slowEdge = false;
+    do{
+        clockEdge();
+        edges++;
+        m_edgeTime += m_mcu->psTick();
+    }while( !m_slowEdge && edges < Z80CORE_MAX_INST_EDGES
+         && !(edges > 1 && !m_nextClock && sm_MCycle == 1 && sm_TState == 1 ) );
+
+    m_edgeTime = 0;
+    m_mcu->cyclesDone = edges;
+}
+
+void Z80Core::clockEdge()
 {
     if( m_nextClock ) clkRisingEdge();
     else              clkFallingEdge();
     m_nextClock = !m_nextClock;
 }
 
+void Z80Core::delayEdge() // Schedule delayed edge at the time this edge happens
+{
+    Simulator::self()->addEvent( m_edgeTime+m_delay, this );
+    m_slowEdge = true;
+}
+
 void Z80Core::clkRisingEdge() // Execution of instruction and sampling bus signal at clock rising edge
 {
     //  Reset is accepted after three TStates
@@ -608,7 +751,8 @@ void Z80Core::clkRisingEdge() // Execution of instruction and sampling bus signa
     sBusReq = !m_busreqPin->getInpState(); /// At Rising edge latst T State ??? - I guess it doesn't matter
 
     // RisingEdgeDelayed
-    Simulator::self()->addEvent( m_delay, this );
+    if( fastCycle() ) risingEdgeDelayed(); // No Pins to drive: no need to delay
+    else              delayEdge();
 }
 
 void Z80Core::clkFallingEdge() // Sampling bus signal at clock falling edge
@@ -622,7 +766,8 @@ void Z80Core::clkFallingEdge() // Sampling bus signal at clock falling edge
     }*/
 
     // FallingEdgeDelayed
-    Simulator::self()->addEvent( m_delay, this );
+    if( fastCycle() ) fallingEdgeDelayed(); // No Pins to drive: no need to delay
+    else              delayEdge();
 }
 
 // Increasing TState, if it is last TState then TState is reset and MCycle is increased
@@ -718,7 +863,7 @@ void Z80Core::risingEdgeDelayed()
         {
         case 1: if( !sm_waitTState  )
                 {
-                    m_addrPort->setOutStatFast( sAO );
+                    if( !busMemOp() ) m_addrPort->setOutStatFast( sAO );
                     if( m_lastBusOp == oMemWrite || m_lastBusOp == oIOWrite ) m_dataPort->setPinMode( input );// If previous bus op. was write data then release data bus
                     if( mc_busOp    == oM1 || mc_busOp    == oIntAck )  m_m1Pin->setOutStatFast( false );// If current bus op. is Fetch (machine cycle 1) then set M1
                     if( m_lastBusOp == oM1 || m_lastBusOp == oIntAck  ) m_rfshPin->setOutStatFast( true );// If previous bus op. was Fetch (machine cycle 1) then signal RFSH is reset
@@ -742,10 +887,10 @@ void Z80Core::risingEdgeDelayed()
                     m_rfshPin->setOutStatFast( false );
 
                     /// address value should be already available
-                    m_addrPort->setOutStatFast( (regI << 8) | regR );
+                    if( !m_busMem ) m_addrPort->setOutStatFast( (regI << 8) | regR );
                     regR = ( (regR + 1) & 0x7f ) + ( regR & 0x80 );
                 }
-                if( mc_busOp == oM1 ) {// It current bus op. is Fetch without interrupt then reset MREQ and RD
+                if( mc_busOp == oM1 && !m_busMem ) {// It current bus op. is Fetch without interrupt then reset MREQ and RD
                     m_mreqPin->setOutStatFast( true );
                     m_rdPin->setOutStatFast( true );
                 }
@@ -754,7 +899,7 @@ void Z80Core::risingEdgeDelayed()
                 // Setting bus at clock rising edge of TState 5 in case of longer machine cycle than 4 TStates
         case 5: if( mc_busOp == oM1 || mc_busOp == oIntAck ) // If bus op. is Fetch (machine cycle 1) then address bus is restored and reset RFSH
                 {
-                    m_addrPort->setOutStatFast( sAO );
+                    if( !m_busMem ) m_addrPort->setOutStatFast( sAO );
                     m_rfshPin->setOutStatFast( true );
                 }
         }
@@ -766,7 +911,9 @@ void Z80Core::fallingEdgeDelayed()
     if( sBusAck == false ) { // Setting bus only when bus is not requested by signal BUSRQ and acknowledged by signal BUSACK
         switch( sm_TState ) {
                 // Setting bus at clock rising edge of TState 1 (it might repeat when wait states are inserted during interrupt)
-        case 1: if( sm_waitTState == false )
+        case 1: if( busMemOp() ) break; // Memory accessed directly
+
+                if( sm_waitTState == false )
                 {
                     if( mc_busOp == oM1 ) {// If  current bus op. is Fetch without interrupt (machine cycle 1) then set MREQ and M1
                         m_mreqPin->setOutStatFast( false );
@@ -787,10 +934,17 @@ void Z80Core::fallingEdgeDelayed()
                     // If  current bus op. is Fetch with interrupt (machine cycle 1) then set IORQ
                     // (There is a difference in TStates numbering from datasheet - one automatically inserted wait states is T1 wait)
                     if (mc_busOp == oIntAck) m_iorqPin->setOutStatFast( false );
-                    if (mc_busOp == oMemWrite) m_wrPin->setOutStatFast( false ); // If  current bus op. is write memory then set WR
+                    if (mc_busOp == oMemWrite){                                    // If  current bus op. is write memory then set WR
+                        if( m_busMem ) m_busMem->writeBus( sAO, sDO );
+                        else           m_wrPin->setOutStatFast( false );
+                    }
                 }
                 break;
-        case 3: if( mc_busOp == oMemRead || mc_busOp == oIORead )// Sampling data bus for Memory read and Input/Output read cycle
+        case 3: if( busMemOp() ){ // Memory accessed directly
+                    if( mc_busOp == oMemRead ) sDI = m_busMem->readBus( sAO );
+                    break;
+                }
+                if( mc_busOp == oMemRead || mc_busOp == oIORead )// Sampling data bus for Memory read and Input/Output read cycle
                     sDI = m_dataPort->getInpState();
 
             /// If  current bus op. is Fetch (machine cycle 1) then reset MREQ
@@ -815,7 +969,7 @@ void Z80Core::fallingEdgeDelayed()
                     m_wrPin->setOutStatFast( true );
                 }
                 break;
-        case 4: if( mc_busOp == oM1 || mc_busOp == oIntAck ) m_mreqPin->setOutStatFast( true ); // If current bus op. is Fetch (machine cycle 1) then reset MREQ
+        case 4: if( (mc_busOp == oM1 && !m_busMem) || mc_busOp == oIntAck ) m_mreqPin->setOutStatFast( true ); // If current bus op. is Fetch (machine cycle 1) then reset MREQ
             /// create Halt variable, state or whatever
                 if( m_iReg == 0x76 && m_iSet == noPrefix )  m_haltPin->setOutStatFast( false ); // If  current instruction is HALT then set HALT
                 if( sNMI || ( sInt && IFF1 ) )              m_haltPin->setOutStatFast( true ); // If interrupt is requested and enabled then reset HALT
@@ -858,7 +1012,7 @@ void Z80Core::opCodeFetch()
 
     switch( sm_M1CycleType ) // Fetching opcode
     {
-        case tOpCodeFetch: m_iReg = m_dataPort->getInpState();   // reading opcode from data bus
+        case tOpCodeFetch: m_iReg = m_busMem ? m_busMem->readBus( sAO ) : m_dataPort->getInpState(); // reading opcode from data bus
             m_PC++;                                            // increase program counter PC
 
             // Set number of machine cycles and TStates for instruction
@@ -2205,3 +2359,4 @@ void Z80Core::setProducer( QString producer )
 void Z80Core::setCmos( bool cmos ) { m_cmos = cmos; }// Setter for CMOS or NMOS version
 void Z80Core::setIoWait( bool ioWait ) { m_ioWait = !ioWait; } // Setter for single wait I/O operation
 void Z80Core::setIntVector( bool intVector ) { m_intVector = intVector; } // Setter for force interrupt vector 0xff
+void Z80Core::setFastExec( bool fast ) { m_fastExec = fast; } // Setter for fast execution of memory cycles
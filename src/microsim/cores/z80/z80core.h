@@ -25,6 +25,9 @@
 #include "z80regs.h"
 
 #define Z80CORE_MAX_T_INT 1000000   // Maximum T cycles after interrupt
+#define Z80CORE_MAX_INST_EDGES 64   // Maximum clock edges executed in one step (fast execution)
+
+class Memory;
 
 class Z80Core : public CpuBase, public eElement
 {
@@ -39,6 +42,9 @@ class Z80Core : public CpuBase, public eElement
         virtual void runStep() override;
         virtual void extClock( bool clkState ) override;
 
+        virtual bool saveState( QDataStream& s ) override;
+        virtual bool loadState( QDataStream& s, bool check ) override;
+
         virtual int getCpuReg( QString reg ) override;
         virtual QString getStrReg( QString reg ) override;
 
@@ -59,12 +65,19 @@ class Z80Core : public CpuBase, public eElement
         void setIoWait( bool ioWait );
         bool intVector() { return m_intVector; }
         void setIntVector( bool intVector );
+        bool fastExec() { return m_fastExec; }
+        void setFastExec( bool fast );
 
     private:
+        void clockEdge();
+        void delayEdge();
         void risingEdgeDelayed();
         void fallingEdgeDelayed();
         void releaseBus( bool rel );
 
+        inline bool busMemOp() { return m_busMem && (mc_busOp == oM1 || mc_busOp == oMemRead || mc_busOp == oMemWrite); }
+        inline bool fastCycle() { return m_instMode && busMemOp() && !sBusAck && !normalReset && !highImpedanceBus; }
+
         // Setting of Z80Core
         enum eProducer { pZilog = 0, pNec, pSt };
         eProducer m_producer;
@@ -75,6 +88,11 @@ class Z80Core : public CpuBase, public eElement
         bool m_cmos;
         bool m_ioWait;
         bool m_intVector;
+        bool m_fastExec; // Fast execution selected by user
+        bool m_instMode; // Fast execution possible in this circuit
+        bool m_slowEdge; // Last clock edge scheduled a delayed event
+
+        uint64_t m_edgeTime; // Time of current clock edge from start of step (internal clock)
 
         uint8_t sm_autoWait;
         bool sm_waitTState;
@@ -93,6 +111,8 @@ class Z80Core : public CpuBase, public eElement
         IoPort* m_dataPort;
         IoPort* m_addrPort;
 
+        Memory* m_busMem; // Memory wired only to this cpu: access it without driving Pins
+
         // Z80Core sampled bus signals
         bool NMIFF;
         bool sLastNMI;
@@ -3,6 +3,9 @@
  *                                                                         *
  ***( see copyright.txt file at root folder )*******************************/
 
+#include <algorithm>
+#include <QDataStream>
+
 #include "e_mcu.h"
 #include "mcu.h"
 #include "cpubase.h"
@@ -40,6 +43,7 @@ eMcu::eMcu( Mcu* comp, QString id )
 
     m_wordSize  = 2;
     m_flashSize = 0;
+    m_flashChanged = false;
     m_romSize   = 0;
     m_ramSize   = 0;
 
@@ -89,11 +93,11 @@ void eMcu::runEvent()
 {
     if( m_state != mcuRunning ) return;
 
-    if( m_debugging )
+    if( m_debugging ) // Wait for instruction cycles in a single event
     {
-        if( cyclesDone > 1 ) cyclesDone -= 1;
-        else                 m_debugger->stepDebug();
-        Simulator::self()->addEvent( m_psTick, this );
+        m_debugger->stepDebug();
+        uint64_t cycles = ( cyclesDone > 1 ) ? cyclesDone : 1;
+        Simulator::self()->addEvent( cycles*m_psTick, this );
     }
     else if( m_state >= mcuRunning && m_freq > 0 )
     {
@@ -102,6 +106,73 @@ void eMcu::runEvent()
     }
 }
 
+bool eMcu::saveState( QDataStream& s )
+{
+    s << (quint64)m_cycle << (qint32)cyclesDone << (qint32)m_state << m_clkState;
+    s << m_freq << (quint64)m_psInst << (quint64)m_psTick; // Can be changed by firmware (PIC OSCCON)
+    s << QByteArray( (const char*)m_dataMem.data(), m_dataMem.size() );
+    s << QByteArray( (const char*)m_progMem.data(), m_progMem.size()*sizeof(uint16_t) );
+    s << m_eeprom;
+    m_interrupts.saveState( s );
+
+    for( McuModule* module : m_modules )
+    {
+        if( dynamic_cast<eElement*>( module ) ) continue; // Saved by Simulator
+        if( module->saveState( s ) ) continue;
+        qDebug() << "eMcu::saveState Error: Module state not supported" << getId() << module->name();
+        return false;
+    }
+    if( !m_cpu || dynamic_cast<eElement*>( m_cpu ) ) return true;
+    if( m_cpu->saveState( s ) ) return true;
+
+    qDebug() << "eMcu::saveState Error: Cpu state not supported" << getId();
+    return false;
+}
+
+bool eMcu::loadState( QDataStream& s, bool check )
+{
+    quint64 cycle, psInst, psTick;
+    qint32 cycles, state;
+    bool clkState;
+    double freq;
+    QByteArray ram, flash;
+    QVector<int> eeprom;
+    s >> cycle >> cycles >> state >> clkState >> freq >> psInst >> psTick >> ram >> flash >> eeprom;
+
+    if( s.status() != QDataStream::Ok ) return false;
+    if( (uint)ram.size() != m_dataMem.size()
+     || (uint)flash.size() != m_progMem.size()*sizeof(uint16_t)
+     || eeprom.size() != m_eeprom.size() )
+    {
+        qDebug() << "eMcu::loadState Error: Memory sizes don't match" << getId();
+        return false;
+    }
+    if( !m_interrupts.loadState( s, check ) ) return false;
+
+    for( McuModule* module : m_modules )
+    {
+        if( dynamic_cast<eElement*>( module ) ) continue;
+        if( !module->loadState( s, check ) ) return false;
+    }
+    if( m_cpu && !dynamic_cast<eElement*>( m_cpu ) && !m_cpu->loadState( s, check ) ) return false;
+    if( check ) return true;
+
+    m_cycle = cycle;
+    cyclesDone = cycles;
+    m_state = (mcuState_t)state;
+    m_clkState = clkState;
+    m_freq   = freq;
+    m_psInst = psInst;
+    m_psTick = psTick;
+
+    memcpy( m_dataMem.data(), ram.constData(), ram.size() );
+    memcpy( m_progMem.data(), flash.constData(), flash.size() );
+    std::fill( m_flashDirty.begin(), m_flashDirty.end(), true );
+    m_flashChanged = true;
+    m_eeprom = eeprom;
+    return true;
+}
+
 void eMcu::stepCpu()
 {
     if( !m_flashSize || m_cpu->getPC() < m_flashSize )
@@ -213,6 +284,13 @@ void eMcu::setFreq( double freq )
     m_freq = freq;
 }
 
+void eMcu::clearFlashDirty()
+{
+    if( !m_flashChanged ) return;
+    std::fill( m_flashDirty.begin(), m_flashDirty.end(), false );
+    m_flashChanged = false;
+}
+
 void eMcu::setEeprom( QVector<int>* eep )
 {
     int size = m_romSize;
@@ -56,6 +56,9 @@ class eMcu : public DataSpace, public eIou
         virtual void voltChanged() override;
         virtual void runEvent() override;
 
+        virtual bool saveState( QDataStream& s ) override;
+        virtual bool loadState( QDataStream& s, bool check ) override;
+
         inline mcuState_t state() { return m_state; }
         inline int sleepMode() { return m_sleepModule->mode(); }
 
@@ -65,7 +68,15 @@ class eMcu : public DataSpace, public eIou
         void setDebugging( bool d );
 
         uint16_t getFlashValue( int address ) { return m_progMem[address]; }
-        void     setFlashValue( int address, uint16_t value ) { m_progMem[address] = value; }
+        void     setFlashValue( int address, uint16_t value )
+        {
+            m_progMem[address] = value;
+            m_flashDirty[address>>4] = true;
+            m_flashChanged = true;
+        }
+        bool flashChanged() { return m_flashChanged; }              // Any Program memory row written
+        bool flashRowDirty( int row ) { return m_flashDirty[row]; } // Row of 16 words written
+        void clearFlashDirty();
         uint32_t flashSize(){ return m_flashSize; }
         uint32_t wordSize() { return m_wordSize; }
 
@@ -88,6 +99,7 @@ class eMcu : public DataSpace, public eIou
         double freq() { return m_freq; }
         void setFreq( double freq );
         uint64_t psInst() { return m_psInst; }  // picoseconds per instruction cycle
+        uint64_t psTick() { return m_psTick; }  // picoseconds per clock tick
         void setInstCycle( double p ){ m_cPerInst = m_cPerTick = p; }
 
         McuTimer* getTimer( QString name );
@@ -124,6 +136,8 @@ class eMcu : public DataSpace, public eIou
 
         uint64_t m_cycle;
         std::vector<uint16_t> m_progMem;  // Program memory
+        std::vector<bool> m_flashDirty;   // Program memory rows written since last clearFlashDirty()
+        bool m_flashChanged;
         uint32_t m_flashSize;
         uint8_t  m_wordSize; // Size of Program memory word in bytes
 
@@ -95,6 +95,7 @@ Mcu::Mcu( QString type, QString id )
     m_scriptLink = NULL;
 
     m_autoLoad = false;
+    m_hotReload = false;
     m_scripted = false;
     m_resetPol = false;
     m_isLinker = true;
@@ -250,6 +251,9 @@ void Mcu::setup( QString type )
 
     addProperty(tr("Main"),new BoolProp<Mcu>("Auto_Load", tr("Reload hex at Simulation Start"),""
                                             , this, &Mcu::autoLoad, &Mcu::setAutoLoad ));
+
+    addProperty(tr("Main"),new BoolProp<Mcu>("Hot_Reload", tr("Load firmware without stopping Simulation"),""
+                                            , this, &Mcu::hotReload, &Mcu::setHotReload ));
     }
     if( m_eMcu.romSize() )
     addProperty(tr("Main"),new BoolProp<Mcu>("saveEepr", tr("EEPROM persitent"),""
@@ -459,7 +463,7 @@ void Mcu::slotLoad()
     if( !dir.exists() ) m_lastFirmDir = Circuit::self()->getFilePath();
 
     QString fileName = QFileDialog::getOpenFileName( NULL, tr("Load Firmware"), m_lastFirmDir,
-                       tr("All files (*.*);;Hex Files (*.hex)"));
+                       tr("All files (*.*);;Hex Files (*.hex);;ELF Files (*.elf)"));
 
     if( fileName.isEmpty() ) return; // User cancels loading
 
@@ -485,18 +489,37 @@ bool Mcu::load( QString fileName )
         qDebug() << "Error: file doesn't exist:\n"<<cleanPathAbs<<"\n";
         return false;
     }
-    if( Simulator::self()->simState() > SIM_STARTING )  CircuitWidget::self()->powerCircOff();
+    Simulator* sim = Simulator::self();
+    bool hotSwap = m_hotReload && sim->simState() > SIM_STARTING;
+    bool paused  = sim->isPaused();
+
+    if( hotSwap )        // Safe point: circuit thread stopped, rest of Circuit keeps its state
+    {
+        sim->pauseSim();
+        sim->waitCircuit();
+    }
+    else if( sim->simState() > SIM_STARTING )  CircuitWidget::self()->powerCircOff();
 
     int size = m_eMcu.flashSize();
     QVector<int> pgm( size );
     for( int i=0; i<size; ++i ) pgm[i] = m_eMcu.getFlashValue( i );
 
     if( !MemData::loadFile( &pgm, cleanPathAbs, false, m_eMcu.m_wordSize*8, &m_eMcu ) )
+    {
+        if( hotSwap && !paused ) sim->resumeSim();
         return false;
-
-    for( int i=0; i<size; ++i ) m_eMcu.setFlashValue( i, pgm.at(i) );
+    }
+    for( int i=0; i<size; ++i ) m_eMcu.setFlashValue( i, pgm.at(i) ); // Marks Flash rows dirty
     qDebug() << "Firmware successfully loaded\n";
 
+    if( hotSwap )        // Reset only this Mcu, keep it in reset if Reset Pin is active
+    {
+        m_eMcu.hardReset( true );
+        if( !m_resetPin || m_resetPin->getInpState() != m_resetPol ) m_eMcu.hardReset( false );
+        if( !paused ) sim->resumeSim();
+        qDebug() << "Firmware hot reloaded:" << idLabel() << "\n";
+    }
+
     QString firmware = circuitDir.relativeFilePath( cleanPathAbs );
     if( m_eMcu.m_firmware != firmware ) Circuit::self()->setChanged();
     m_eMcu.m_firmware = firmware;
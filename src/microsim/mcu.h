@@ -48,6 +48,9 @@ class Mcu : public Chip, public Linker
         bool autoLoad() { return m_autoLoad; }
         void setAutoLoad( bool al ) { m_autoLoad = al; }
 
+        bool hotReload() { return m_hotReload; }
+        void setHotReload( bool h ) { m_hotReload = h; }
+
         double extFreq() { return m_extFreq; }
         void setExtFreq( double freq ) { m_extFreq = freq; setFreq( freq ); }
 
@@ -130,6 +133,7 @@ class Mcu : public Chip, public Linker
         //deviceType_t m_deviceType;
 
         bool m_autoLoad;
+        bool m_hotReload; // Load firmware while Simulation runs: only this Mcu is reset
         bool m_scripted;
         bool m_resetPol;
 
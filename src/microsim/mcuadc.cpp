@@ -3,6 +3,8 @@
  *                                                                         *
  ***( see copyright.txt file at root folder )*******************************/
 
+#include <QDataStream>
+
 #include "mcuadc.h"
 #include "mcupin.h"
 #include "e_mcu.h"
@@ -63,6 +65,41 @@ void McuAdc::startConversion()
     Simulator::self()->addEvent( m_convTime, this );
 }
 
+bool McuAdc::saveState( QDataStream& s )
+{
+    saveModule( s );
+    s << m_enabled << m_converting << m_leftAdjust << m_adcClock << m_adcValue << m_maxValue;
+    s << (quint64)m_convTime << m_channel << m_chOffset << m_vRefP << m_vRefN;
+    return true;
+}
+
+bool McuAdc::loadState( QDataStream& s, bool check )
+{
+    if( !loadModule( s, check ) ) return false;
+
+    bool enabled, converting, leftAdjust, adcClock;
+    uint16_t adcValue, maxValue;
+    quint64 convTime;
+    uint channel, chOffset;
+    double vRefP, vRefN;
+    s >> enabled >> converting >> leftAdjust >> adcClock >> adcValue >> maxValue;
+    s >> convTime >> channel >> chOffset >> vRefP >> vRefN;
+    if( check || s.status() != QDataStream::Ok ) return s.status() == QDataStream::Ok;
+
+    m_enabled    = enabled;
+    m_converting = converting;
+    m_leftAdjust = leftAdjust;
+    m_adcClock   = adcClock;
+    m_adcValue   = adcValue;
+    m_maxValue   = maxValue;
+    m_convTime   = convTime;
+    m_channel    = channel;
+    m_chOffset   = chOffset;
+    m_vRefP      = vRefP;
+    m_vRefN      = vRefN;
+    return true;
+}
+
 void McuAdc::updtVref()
 {
     m_vRefP = m_mcu->vdd();
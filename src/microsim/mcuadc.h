@@ -27,6 +27,9 @@ class McuAdc : public McuPrescaled, public eElement
 
         virtual void startConversion();
 
+        virtual bool saveState( QDataStream& s ) override;
+        virtual bool loadState( QDataStream& s, bool check ) override;
+
     protected:
         virtual void updtVref();
         virtual void specialConv();
@@ -3,8 +3,11 @@
  *                                                                         *
  ***( see copyright.txt file at root folder )*******************************/
 
+#include <QDataStream>
+
 #include "mcucomparator.h"
 #include "e_mcu.h"
+#include "mcupin.h"
 
 McuComp::McuComp( eMcu* mcu, QString name )
        : McuModule( mcu, name )
@@ -26,6 +29,44 @@ void McuComp::initialize()
     setMode( 0 );
 }
 
+static QString pinName( McuPin* pin ) { return pin ? pin->pinId().split("-").last() : ""; }
+
+bool McuComp::saveState( QDataStream& s )
+{
+    saveModule( s );
+    s << m_fixVref << m_enabled << m_compOut << m_vref << m_mode;
+    s << pinName( m_pinP ) << pinName( m_pinN ) << pinName( m_pinOut ); // Inputs can be switched by firmware
+    return true;
+}
+
+bool McuComp::loadState( QDataStream& s, bool check )
+{
+    if( !loadModule( s, check ) ) return false;
+
+    bool fixVref, enabled, compOut;
+    double vref;
+    uint8_t mode;
+    QString pinP, pinN, pinOut;
+    s >> fixVref >> enabled >> compOut >> vref >> mode;
+    s >> pinP >> pinN >> pinOut;
+    if( check || s.status() != QDataStream::Ok ) return s.status() == QDataStream::Ok;
+
+    m_fixVref = fixVref;
+    m_enabled = enabled;
+    m_compOut = compOut;
+    m_vref    = vref;
+    m_mode    = mode;
+
+    if( m_pinP ) m_pinP->changeCallBack( this, false );
+    if( m_pinN ) m_pinN->changeCallBack( this, false );
+    m_pinP   = m_mcu->getMcuPin( pinP );
+    m_pinN   = m_mcu->getMcuPin( pinN );
+    m_pinOut = m_mcu->getMcuPin( pinOut );
+    if( m_pinP ) m_pinP->changeCallBack( this, true );
+    if( m_pinN ) m_pinN->changeCallBack( this, true );
+    return true;
+}
+
 void McuComp::callBackDoub( double vref ) // Called from Vref module
 {
     m_vref = vref;
@@ -25,6 +25,9 @@ class McuComp : public McuModule, public eElement
 
         virtual void callBackDoub( double vref ) override;
 
+        virtual bool saveState( QDataStream& s ) override;
+        virtual bool loadState( QDataStream& s, bool check ) override;
+
     protected:
         virtual void setMode( uint8_t mode ) { m_mode = mode; }
 
@@ -310,6 +310,9 @@ void McuCreator::createProgMem( uint32_t size )
     if     ( m_core == "Pic14" )  mcu->m_progMem.resize( size, 0x3FFF );
     else if( m_core == "Pic14e" ) mcu->m_progMem.resize( size, 0x3FFF );
     else                          mcu->m_progMem.resize( size, 0xFFFF );
+
+    mcu->m_flashDirty.assign( size/16+1, true );
+    mcu->m_flashChanged = true;
 }
 
 void McuCreator::createDataMem( uint32_t size )
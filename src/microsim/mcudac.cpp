@@ -3,6 +3,8 @@
  *                                                                         *
  ***( see copyright.txt file at root folder )*******************************/
 
+#include <QDataStream>
+
 #include "mcudac.h"
 #include "e_mcu.h"
 
@@ -27,3 +29,29 @@ void McuDac::initialize()
     m_vRefP = 0;
     m_vRefN = 0;
 }
+
+bool McuDac::saveState( QDataStream& s )
+{
+    saveModule( s );
+    s << m_enabled << m_outVoltEn << m_outVolt << m_vRefP << m_vRefN << m_outVal;
+    return true;
+}
+
+bool McuDac::loadState( QDataStream& s, bool check )
+{
+    if( !loadModule( s, check ) ) return false;
+
+    bool enabled, outVoltEn;
+    double outVolt, vRefP, vRefN;
+    uint8_t outVal;
+    s >> enabled >> outVoltEn >> outVolt >> vRefP >> vRefN >> outVal;
+    if( check || s.status() != QDataStream::Ok ) return s.status() == QDataStream::Ok;
+
+    m_enabled   = enabled;
+    m_outVoltEn = outVoltEn;
+    m_outVolt   = outVolt;
+    m_vRefP     = vRefP;
+    m_vRefN     = vRefN;
+    m_outVal    = outVal;
+    return true;
+}
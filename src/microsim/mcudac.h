@@ -24,6 +24,9 @@ class McuDac: public McuModule, public eElement
 
         virtual void outRegChanged( uint8_t ){;}
 
+        virtual bool saveState( QDataStream& s ) override;
+        virtual bool loadState( QDataStream& s, bool check ) override;
+
     protected:
 
         bool m_enabled;
@@ -24,6 +24,7 @@ class DataSpace
 
         uint32_t ramSize()  { return m_ramSize; }
         uint8_t  getRamValue( int address );
+        uint8_t  getRawRam( int address ) { return m_dataMem[m_addrMap[address]]; } // Read without calling Watchers
         void     setRamValue( int address, uint8_t value );
         uint8_t* getRam() { return m_dataMem.data(); }  // Get pointer to Ram data
         uint16_t getMapperAddr( uint16_t addr ) { return m_addrMap[addr]; } // Get mapped addresses in Data space
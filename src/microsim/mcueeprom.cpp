@@ -3,6 +3,8 @@
  *                                                                         *
  ***( see copyright.txt file at root folder )*******************************/
 
+#include <QDataStream>
+
 #include "mcueeprom.h"
 #include "simulator.h"
 #include "e_mcu.h"
@@ -25,6 +27,25 @@ void McuEeprom::initialize()
     m_address = 0;
 }
 
+bool McuEeprom::saveState( QDataStream& s )
+{
+    saveModule( s );
+    s << m_address;
+    return true;
+}
+
+bool McuEeprom::loadState( QDataStream& s, bool check )
+{
+    if( !loadModule( s, check ) ) return false;
+
+    uint32_t address;
+    s >> address;
+    if( check || s.status() != QDataStream::Ok ) return s.status() == QDataStream::Ok;
+
+    m_address = address;
+    return true;
+}
+
 void McuEeprom::readEeprom()
 {
     *m_dataReg = m_mcu->getRomValue( m_address );
@@ -25,6 +25,9 @@ class McuEeprom : public McuModule, public eElement
         virtual void addrWriteL( uint8_t val );
         virtual void addrWriteH( uint8_t val );
 
+        virtual bool saveState( QDataStream& s ) override;
+        virtual bool loadState( QDataStream& s, bool check ) override;
+
     protected:
 
         uint8_t* m_addressL; // Actual ram for counter Low address byte
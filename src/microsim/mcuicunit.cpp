@@ -3,6 +3,8 @@
  *                                                                         *
  ***( see copyright.txt file at root folder )*******************************/
 
+#include <QDataStream>
+
 #include "mcuicunit.h"
 #include "mcutimer.h"
 #include "mcuinterrupts.h"
@@ -51,3 +53,28 @@ void McuIcUnit::enable( bool en )
     m_enabled = en;
     if( m_icPin ) m_icPin->changeCallBack( this, en );
 }
+
+bool McuIcUnit::saveState( QDataStream& s )
+{
+    saveModule( s );
+    s << m_enabled << m_inState << m_mode << m_fallingEdge;
+    return true;
+}
+
+bool McuIcUnit::loadState( QDataStream& s, bool check )
+{
+    if( !loadModule( s, check ) ) return false;
+
+    bool enabled, inState, fallingEdge;
+    uint8_t mode;
+    s >> enabled >> inState >> mode >> fallingEdge;
+    if( check || s.status() != QDataStream::Ok ) return s.status() == QDataStream::Ok;
+
+    m_enabled     = enabled;
+    m_inState     = inState;
+    m_mode        = mode;
+    m_fallingEdge = fallingEdge;
+
+    if( m_icPin ) m_icPin->changeCallBack( this, m_enabled );
+    return true;
+}
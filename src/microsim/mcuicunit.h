@@ -27,6 +27,9 @@ class McuIcUnit : public McuModule, public eElement
 
         void enable( bool en );
 
+        virtual bool saveState( QDataStream& s ) override;
+        virtual bool loadState( QDataStream& s, bool check ) override;
+
     protected:
         McuTimer* m_timer;
         McuPin*   m_icPin;
@@ -4,6 +4,7 @@
  ***( see copyright.txt file at root folder )*******************************/
 
 #include <QDebug>
+#include <QDataStream>
 
 #include "mcuinterrupts.h"
 #include "cpubase.h"
@@ -246,3 +247,74 @@ void Interrupts::remFromPending( Interrupt* remInt )
         preInt = posInt;
         posInt = posInt->m_nextInt;
 }   }
+
+void Interrupts::saveState( QDataStream& s )
+{
+    QStringList names = m_intList.keys();
+    names.sort();
+
+    QStringList running, pending;
+    for( Interrupt* i=m_running; i; i=i->m_nextInt ) running.append( i->m_name );
+    for( Interrupt* i=m_pending; i; i=i->m_nextInt ) pending.append( i->m_name );
+
+    s << m_enabled << m_reti << ( m_active ? m_active->m_name : "" ) << running << pending;
+
+    for( QString name : names )
+    {
+        Interrupt* i = m_intList.value( name );
+        s << i->m_enabled << i->m_priority << i->m_raised << i->m_autoClear << i->m_continuous;
+}   }
+
+bool Interrupts::loadState( QDataStream& s, bool check )
+{
+    QStringList names = m_intList.keys();
+    names.sort();
+
+    uint8_t enabled;
+    bool reti;
+    QString active;
+    QStringList running, pending;
+    s >> enabled >> reti >> active >> running >> pending;
+
+    if( !active.isEmpty() && !m_intList.contains( active ) ) return false;
+    for( QString name : running+pending ) if( !m_intList.contains( name ) ) return false;
+
+    QVector<uint8_t> intEnabled( names.size() ), priority( names.size() );
+    QVector<bool> raised( names.size() ), autoClear( names.size() ), continuous( names.size() );
+    for( int i=0; i<names.size(); ++i )
+    {
+        bool r, a, c;
+        s >> intEnabled[i] >> priority[i] >> r >> a >> c;
+        raised[i] = r; autoClear[i] = a; continuous[i] = c;
+    }
+    if( check || s.status() != QDataStream::Ok ) return s.status() == QDataStream::Ok;
+
+    for( int i=0; i<names.size(); ++i )
+    {
+        Interrupt* inte = m_intList.value( names.at( i ) );
+        inte->m_enabled    = intEnabled.at( i );
+        inte->m_priority   = priority.at( i );
+        inte->m_raised     = raised.at( i );
+        inte->m_autoClear  = autoClear.at( i );
+        inte->m_continuous = continuous.at( i );
+    }
+    m_enabled = enabled;
+    m_reti    = reti;
+    m_active  = active.isEmpty() ? NULL : m_intList.value( active );
+
+    m_running = NULL;           // Rebuild linked lists in same order
+    for( int i=running.size()-1; i>=0; --i )
+    {
+        Interrupt* inte = m_intList.value( running.at( i ) );
+        inte->m_nextInt = m_running;
+        m_running = inte;
+    }
+    m_pending = NULL;
+    for( int i=pending.size()-1; i>=0; --i )
+    {
+        Interrupt* inte = m_intList.value( pending.at( i ) );
+        inte->m_nextInt = m_pending;
+        m_pending = inte;
+    }
+    return true;
+}
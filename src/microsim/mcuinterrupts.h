@@ -16,10 +16,12 @@ class eMcu;
 class Interrupts;
 class McuModule;
 class IoPin;
+class QDataStream;
 
 class Interrupt
 {
         friend class McuCreator;
+        friend class Interrupts;
 
     public:
         Interrupt( QString name, uint16_t vector, eMcu* mcu );
@@ -100,6 +102,9 @@ class Interrupts
         void addToPending( Interrupt* newInt );
         void remFromPending( Interrupt* remInt );
 
+        void saveState( QDataStream& s ); // Simulation checkpoint
+        bool loadState( QDataStream& s, bool check );
+
     protected:
         eMcu* m_mcu;
 
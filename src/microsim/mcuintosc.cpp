@@ -3,6 +3,8 @@
  *                                                                         *
  ***( see copyright.txt file at root folder )*******************************/
 
+#include <QDataStream>
+
 #include "mcuintosc.h"
 #include "simulator.h"
 #include "mcupin.h"
@@ -51,6 +53,37 @@ void McuIntOsc::runEvent()
     Simulator::self()->addEvent( m_psInst, this );
 }
 
+bool McuIntOsc::saveState( QDataStream& s )
+{
+    saveModule( s );
+    s << (quint64)m_psInst << m_multiplier << m_intOscFreq << m_configFreq;
+    s << m_extClock << m_clkInIO << m_clkOutIO << m_clkOut;
+    return true;
+}
+
+bool McuIntOsc::loadState( QDataStream& s, bool check )
+{
+    if( !loadModule( s, check ) ) return false;
+
+    quint64 psInst;
+    uint8_t multiplier;
+    double intOscFreq, configFreq;
+    bool extClock, clkInIO, clkOutIO, clkOut;
+    s >> psInst >> multiplier >> intOscFreq >> configFreq;
+    s >> extClock >> clkInIO >> clkOutIO >> clkOut;
+    if( check || s.status() != QDataStream::Ok ) return s.status() == QDataStream::Ok;
+
+    m_psInst     = psInst;
+    m_multiplier = multiplier;
+    m_intOscFreq = intOscFreq;
+    m_configFreq = configFreq;
+    m_extClock   = extClock;
+    m_clkInIO    = clkInIO;
+    m_clkOutIO   = clkOutIO;
+    m_clkOut     = clkOut;
+    return true;
+}
+
 bool McuIntOsc::extClock()
 {
     return m_extClock;
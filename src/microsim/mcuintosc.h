@@ -22,6 +22,9 @@ class McuIntOsc : public McuModule, public eElement
         virtual void stamp() override;
         virtual void runEvent() override;
 
+        virtual bool saveState( QDataStream& s ) override;
+        virtual bool loadState( QDataStream& s, bool check ) override;
+
         bool extClock();
         void enableExtOsc( bool en );
 
@@ -3,6 +3,8 @@
  *                                                                         *
  ***( see copyright.txt file at root folder )*******************************/
 
+#include <QDataStream>
+
 #include "mcumodule.h"
 #include "e_mcu.h"
 #include "mcuinterrupts.h"
@@ -25,6 +27,23 @@ void McuModule::sleep( int mode )
     else           m_sleeping = (m_sleepMode & 1<<mode) > 0;
 }
 
+void McuModule::saveModule( QDataStream& s )
+{
+    s << m_sleepMode << m_sleeping;
+}
+
+bool McuModule::loadModule( QDataStream& s, bool check )
+{
+    uint8_t sleepMode;
+    bool sleeping;
+    s >> sleepMode >> sleeping;
+    if( check || s.status() != QDataStream::Ok ) return s.status() == QDataStream::Ok;
+
+    m_sleepMode = sleepMode;
+    m_sleeping  = sleeping;
+    return true;
+}
+
 /*void McuModule::reset()
 {
     Simulator::self()->cancelEvents( this );
@@ -12,6 +12,7 @@
 
 class eMcu;
 class Interrupt;
+class QDataStream;
 
 class McuModule
 {
@@ -30,6 +31,9 @@ class McuModule
         virtual void callBack() {;}
         virtual void sleep( int mode );
 
+        virtual bool saveState( QDataStream& ){ return false; } // Simulation checkpoint: false if not supported
+        virtual bool loadState( QDataStream&, bool ){ return false; }
+
         void setSleepMode( uint8_t m ) { m_sleepMode = m; }
 
         virtual void setInterrupt( Interrupt* i ) { m_interrupt = i; }
@@ -37,7 +41,12 @@ class McuModule
 
         eMcu* getMcu() { return m_mcu; }
 
+        QString name() { return m_name; }
+
     protected:
+        void saveModule( QDataStream& s );            // State common to all modules
+        bool loadModule( QDataStream& s, bool check );
+
         QString m_name;
         eMcu*   m_mcu;
 
@@ -3,6 +3,8 @@
  *                                                                         *
  ***( see copyright.txt file at root folder )*******************************/
 
+#include <QDataStream>
+
 #include "mcuocm.h"
 #include "mcuocunit.h"
 #include "mcupin.h"
@@ -28,6 +30,29 @@ void McuOcm::initialize()
     if( m_OC1 ) m_oPin = m_OC1->getPin();
 }
 
+bool McuOcm::saveState( QDataStream& s )
+{
+    saveModule( s );
+    s << m_state1 << m_state2 << m_oc1Active << m_oc2Active << m_mode;
+    return true;
+}
+
+bool McuOcm::loadState( QDataStream& s, bool check )
+{
+    if( !loadModule( s, check ) ) return false;
+
+    bool state1, state2, oc1Active, oc2Active, mode;
+    s >> state1 >> state2 >> oc1Active >> oc2Active >> mode;
+    if( check || s.status() != QDataStream::Ok ) return s.status() == QDataStream::Ok;
+
+    m_state1    = state1;
+    m_state2    = state2;
+    m_oc1Active = oc1Active;
+    m_oc2Active = oc2Active;
+    m_mode      = mode;
+    return true;
+}
+
 void McuOcm::setOcActive( McuOcUnit* oc, bool a ) // OC units call when activated/deactivated
 {
     if( oc == m_OC1 ) m_oc1Active = a;
@@ -26,6 +26,9 @@ class McuOcm : public McuPrescaled, public eElement
         void setOcActive( McuOcUnit* oc, bool a );
         void setState( McuOcUnit* oc, bool s );
 
+        virtual bool saveState( QDataStream& s ) override;
+        virtual bool loadState( QDataStream& s, bool check ) override;
+
     protected:
         virtual void OutputOcm()=0;
 
@@ -3,6 +3,8 @@
  *                                                                         *
  ***( see copyright.txt file at root folder )*******************************/
 
+#include <QDataStream>
+
 #include "mcuocunit.h"
 #include "mcupin.h"
 #include "e_mcu.h"
@@ -33,6 +35,37 @@ void McuOcUnit::initialize()
     m_ocPin->controlPin( false, false );
 }
 
+bool McuOcUnit::saveState( QDataStream& s )
+{
+    saveModule( s );
+    s << (qint32)m_comAct << (qint32)m_tovAct << m_enabled << m_ctrlPin << m_mode;
+    s << m_comMatch << m_extMatch << m_pinSet;
+    return true;
+}
+
+bool McuOcUnit::loadState( QDataStream& s, bool check )
+{
+    if( !loadModule( s, check ) ) return false;
+
+    qint32 comAct, tovAct;
+    bool enabled, ctrlPin, pinSet;
+    uint8_t mode;
+    uint16_t comMatch, extMatch;
+    s >> comAct >> tovAct >> enabled >> ctrlPin >> mode;
+    s >> comMatch >> extMatch >> pinSet;
+    if( check || s.status() != QDataStream::Ok ) return s.status() == QDataStream::Ok;
+
+    m_comAct   = (ocAct_t)comAct;
+    m_tovAct   = (ocAct_t)tovAct;
+    m_enabled  = enabled;
+    m_ctrlPin  = ctrlPin;
+    m_mode     = mode;
+    m_comMatch = comMatch;
+    m_extMatch = extMatch;
+    m_pinSet   = pinSet;
+    return true;
+}
+
 void McuOcUnit::clockStep( uint16_t count )
 {
     if( count == m_extMatch ) runEvent();
@@ -38,6 +38,9 @@ class McuOcUnit : public McuModule, public eElement
 
         virtual void setOcActs( ocAct_t comAct, ocAct_t tovAct );
 
+        virtual bool saveState( QDataStream& s ) override;
+        virtual bool loadState( QDataStream& s, bool check ) override;
+
         void setCtrlPin( bool c ) { m_ctrlPin = c; }
 
         void clockStep( uint16_t count );
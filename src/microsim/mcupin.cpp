@@ -3,6 +3,8 @@
  *                                                                         *
  ***( see copyright.txt file at root folder )*******************************/
 
+#include <QDataStream>
+
 #include "mcupin.h"
 #include "mcuport.h"
 #include "e_mcu.h"
@@ -35,6 +37,37 @@ McuPin::McuPin( McuPort* port, int i, QString id, Component* mcu )
 }
 McuPin::~McuPin() {}
 
+bool McuPin::saveState( QDataStream& s )
+{
+    IoPin::saveState( s );
+    s << m_isAnalog << m_isOut << m_openColl << m_outCtrl << m_dirCtrl << m_portState;
+    s << (qint32)m_portMode << (qint32)m_extIntTrigger;
+    return true;
+}
+
+bool McuPin::loadState( QDataStream& s, bool check )
+{
+    if( !IoPin::loadState( s, check ) ) return false;
+
+    bool isAnalog, isOut, openColl, outCtrl, dirCtrl, portState;
+    qint32 portMode, extIntTrigger;
+    s >> isAnalog >> isOut >> openColl >> outCtrl >> dirCtrl >> portState;
+    s >> portMode >> extIntTrigger;
+    if( check || s.status() != QDataStream::Ok ) return s.status() == QDataStream::Ok;
+
+    m_isAnalog  = isAnalog;
+    m_isOut     = isOut;
+    m_openColl  = openColl;
+    m_outCtrl   = outCtrl;
+    m_dirCtrl   = dirCtrl;
+    m_portState = portState;
+    m_portMode  = (pinMode_t)portMode;
+    m_extIntTrigger = (extIntTrig_t)extIntTrigger;
+
+    if( !m_dirCtrl ) changeCallBack( this, m_changeCB || !m_isOut ); // Peripherals restore their own callbacks
+    return true;
+}
+
 void McuPin::initialize()
 {
     m_outCtrl = false;
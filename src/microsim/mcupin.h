@@ -33,6 +33,9 @@ class McuPin : public IoPin
         virtual void initialize() override;
         virtual void stamp() override;
         virtual void voltChanged() override;
+
+        virtual bool saveState( QDataStream& s ) override;
+        virtual bool loadState( QDataStream& s, bool check ) override;
         virtual bool getInpState() override;
 
         virtual void setOutState( bool state ) override;
@@ -4,6 +4,7 @@
  ***( see copyright.txt file at root folder )*******************************/
 
 #include <QDebug>
+#include <QDataStream>
 
 #include "mcuport.h"
 //#include "mcupin.h"
@@ -39,6 +40,23 @@ void McuPort::reset()
     /// for( McuPin* pin : m_pins ) pin->reset();
 }
 
+bool McuPort::saveState( QDataStream& s ) // Pins save their own state
+{
+    s << m_pinState << m_intMask;
+    return true;
+}
+
+bool McuPort::loadState( QDataStream& s, bool check )
+{
+    uint8_t pinState, intMask;
+    s >> pinState >> intMask;
+    if( check || s.status() != QDataStream::Ok ) return s.status() == QDataStream::Ok;
+
+    m_pinState = pinState;
+    m_intMask  = intMask;
+    return true;
+}
+
 void McuPort::pinChanged( uint8_t pinMask, uint8_t val ) // Pin number in pinMask
 {
     uint8_t pinState = (m_pinState & ~pinMask) | (val & pinMask);
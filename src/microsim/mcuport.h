@@ -26,6 +26,9 @@ class McuPort : public McuModule
         ~McuPort();
 
         virtual void reset() override;
+
+        virtual bool saveState( QDataStream& s ) override;
+        virtual bool loadState( QDataStream& s, bool check ) override;
         virtual void pinChanged( uint8_t pinMask, uint8_t val );
 
         void setPullups( uint8_t puMask );
@@ -35,8 +38,6 @@ class McuPort : public McuModule
         McuPin* getPinN( uint8_t i );
         McuPin* getPin( QString pinName );
 
-        QString name() { return m_name; }
-
         virtual void outChanged( uint8_t val );
         virtual void dirChanged( uint8_t val );
 
@@ -3,6 +3,8 @@
  *                                                                         *
  ***( see copyright.txt file at root folder )*******************************/
 
+#include <QDataStream>
+
 #include "mcuprescaled.h"
 
 McuPrescaled::McuPrescaled( eMcu* mcu, QString name )
@@ -17,3 +19,23 @@ void McuPrescaled::setPrescIndex( uint16_t p )
     m_prIndex = p;
     m_prescaler = m_prescList.at( m_prIndex );
 }
+
+void McuPrescaled::saveModule( QDataStream& s )
+{
+    McuModule::saveModule( s );
+    s << m_prIndex << m_prescaler;
+}
+
+bool McuPrescaled::loadModule( QDataStream& s, bool check )
+{
+    if( !McuModule::loadModule( s, check ) ) return false;
+
+    uint8_t prIndex;
+    uint16_t prescaler;
+    s >> prIndex >> prescaler;
+    if( check || s.status() != QDataStream::Ok ) return s.status() == QDataStream::Ok;
+
+    m_prIndex   = prIndex;
+    m_prescaler = prescaler;
+    return true;
+}
@@ -20,6 +20,9 @@ class McuPrescaled : public McuModule
         void setPrescIndex( uint16_t p );
 
     protected:
+        void saveModule( QDataStream& s );
+        bool loadModule( QDataStream& s, bool check );
+
         regBits_t m_prSelBits;              // Bits configuring prescaler index
         uint8_t  m_prIndex;                 // Prescaler index
         uint16_t m_prescaler;               // Actual Prescaler value
@@ -4,6 +4,7 @@
  ***( see copyright.txt file at root folder )*******************************/
 
 #include <QDebug>
+#include <QDataStream>
 
 #include "mcusleep.h"
 #include "e_mcu.h"
@@ -26,3 +27,22 @@ void McuSleep::callBack()
     qDebug() << "McuSleep Exit Sleep\n";
     m_mcu->sleep( false );
 }
+
+bool McuSleep::saveState( QDataStream& s )
+{
+    saveModule( s );
+    s << m_enabled;
+    return true;
+}
+
+bool McuSleep::loadState( QDataStream& s, bool check )
+{
+    if( !loadModule( s, check ) ) return false;
+
+    bool enabled;
+    s >> enabled;
+    if( check || s.status() != QDataStream::Ok ) return s.status() == QDataStream::Ok;
+
+    m_enabled = enabled;
+    return true;
+}
@@ -23,6 +23,9 @@ class McuSleep : public McuModule, public eElement
         //virtual void sleep(){;}
         virtual void callBack() override;
 
+        virtual bool saveState( QDataStream& s ) override;
+        virtual bool loadState( QDataStream& s, bool check ) override;
+
     protected:
         bool m_enabled;
 
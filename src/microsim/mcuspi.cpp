@@ -3,6 +3,8 @@
  *                                                                         *
  ***( see copyright.txt file at root folder )*******************************/
 
+#include <QDataStream>
+
 #include "mcuspi.h"
 #include "iopin.h"
 #include "e_mcu.h"
@@ -19,6 +21,18 @@ McuSpi::~McuSpi()
 {
 }
 
+bool McuSpi::saveState( QDataStream& s )
+{
+    saveModule( s );
+    return SpiModule::saveState( s );
+}
+
+bool McuSpi::loadState( QDataStream& s, bool check )
+{
+    if( !loadModule( s, check ) ) return false;
+    return SpiModule::loadState( s, check );
+}
+
 /*void McuSpi::initialize()
 {
     SpiModule::initialize();
@@ -22,6 +22,9 @@ class McuSpi : public McuPrescaled, public SpiModule
 
         //virtual void initialize() override;
 
+        virtual bool saveState( QDataStream& s ) override;
+        virtual bool loadState( QDataStream& s, bool check ) override;
+
         //virtual void setMode( spiMode_t mode ) override;
         virtual void writeStatus( uint8_t val ){;}
         virtual void writeSpiReg( uint8_t val ){;}
@@ -3,6 +3,8 @@
  *                                                                         *
  ***( see copyright.txt file at root folder )*******************************/
 
+#include <QDataStream>
+
 #include "mcutimer.h"
 #include "e_mcu.h"
 #include "mcupin.h"
@@ -84,6 +86,48 @@ void McuTimer::sleep( int mode )
     }
 }
 
+bool McuTimer::saveState( QDataStream& s )
+{
+    saveModule( s );
+    s << (quint64)m_scale << m_running << m_bidirec << m_reverse << m_extClock;
+    s << m_countVal << m_countStart << m_maxCount << m_ovfMatch << m_ovfPeriod << (quint64)m_ovfCycle;
+    s << m_mode << m_clkEdge << m_clkState;
+    return true;
+}
+
+bool McuTimer::loadState( QDataStream& s, bool check )
+{
+    if( !loadModule( s, check ) ) return false;
+
+    quint64 scale, ovfCycle;
+    bool running, bidirec, reverse, extClock, clkState;
+    uint32_t countVal, countStart, ovfPeriod;
+    uint16_t maxCount, ovfMatch;
+    uint8_t mode, clkEdge;
+    s >> scale >> running >> bidirec >> reverse >> extClock;
+    s >> countVal >> countStart >> maxCount >> ovfMatch >> ovfPeriod >> ovfCycle;
+    s >> mode >> clkEdge >> clkState;
+    if( check || s.status() != QDataStream::Ok ) return s.status() == QDataStream::Ok;
+
+    m_scale      = scale;
+    m_running    = running;
+    m_bidirec    = bidirec;
+    m_reverse    = reverse;
+    m_extClock   = extClock;
+    m_countVal   = countVal;
+    m_countStart = countStart;
+    m_maxCount   = maxCount;
+    m_ovfMatch   = ovfMatch;
+    m_ovfPeriod  = ovfPeriod;
+    m_ovfCycle   = ovfCycle;
+    m_mode       = mode;
+    m_clkEdge    = clkEdge;
+    m_clkState   = clkState;
+
+    if( m_clockPin ) m_clockPin->changeCallBack( this, m_extClock );
+    return true;
+}
+
 void McuTimer::clockStep()  // Timer driven by external clock
 {
     m_countVal++;
@@ -33,6 +33,9 @@ class McuTimer : public McuPrescaled, public eElement
 
         virtual void sleep( int mode ) override;
 
+        virtual bool saveState( QDataStream& s ) override;
+        virtual bool loadState( QDataStream& s, bool check ) override;
+
         virtual void resetTimer();
 
         virtual void enable( uint8_t en );
@@ -3,6 +3,8 @@
  *                                                                         *
  ***( see copyright.txt file at root folder )*******************************/
 
+#include <QDataStream>
+
 #include "mcutwi.h"
 #include "e_mcu.h"
 
@@ -13,6 +15,8 @@ McuTwi::McuTwi( eMcu* mcu, QString name )
     m_dataReg = NULL;
     m_addrReg = NULL;
     m_statReg = NULL;
+
+    m_fastSlave = false; // Mcu slaves run their own state machine
 }
 
 McuTwi::~McuTwi()
@@ -27,3 +31,14 @@ void McuTwi::initialize()
     updateFreq();
 }
 
+bool McuTwi::saveState( QDataStream& s )
+{
+    saveModule( s );
+    return TwiModule::saveState( s );
+}
+
+bool McuTwi::loadState( QDataStream& s, bool check )
+{
+    if( !loadModule( s, check ) ) return false;
+    return TwiModule::loadState( s, check );
+}
@@ -22,6 +22,9 @@ class McuTwi : public McuPrescaled, public TwiModule
 
         virtual void initialize() override;
 
+        virtual bool saveState( QDataStream& s ) override;
+        virtual bool loadState( QDataStream& s, bool check ) override;
+
         virtual void writeAddrReg( uint8_t val ){ m_address = val; }
         virtual void writeStatus( uint8_t val ){;}
         virtual void writeTwiReg( uint8_t val ){;}
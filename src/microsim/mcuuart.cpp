@@ -3,6 +3,8 @@
  *                                                                         *
  ***( see copyright.txt file at root folder )*******************************/
 
+#include <QDataStream>
+
 #include "mcuuart.h"
 #include "serialmon.h"
 #include "usartrx.h"
@@ -44,3 +46,34 @@ void McuUsart::setBit9Rx( uint8_t bit )
 {
     writeRegBits( m_bit9Rx, bit );
 }
+
+bool McuUsart::saveState( QDataStream& s )
+{
+    saveModule( s );
+    s << m_mode << m_stopBits << m_dataBits << m_dataMask << (qint32)m_parity;
+    s << m_sync << m_baudRate << m_speedx2;
+    return true;
+}
+
+bool McuUsart::loadState( QDataStream& s, bool check )
+{
+    if( !loadModule( s, check ) ) return false;
+
+    uint8_t mode, stopBits, dataBits, dataMask;
+    qint32 parity;
+    bool sync, speedx2;
+    int baudRate;
+    s >> mode >> stopBits >> dataBits >> dataMask >> parity;
+    s >> sync >> baudRate >> speedx2;
+    if( check || s.status() != QDataStream::Ok ) return s.status() == QDataStream::Ok;
+
+    m_mode     = mode;
+    m_stopBits = stopBits;
+    m_dataBits = dataBits;
+    m_dataMask = dataMask;
+    m_parity   = (parity_t)parity;
+    m_sync     = sync;
+    m_baudRate = baudRate;
+    m_speedx2  = speedx2;
+    return true;
+}
@@ -25,6 +25,9 @@ class McuUsart : public McuModule, public UsartModule
         virtual uint8_t getBit9Tx() override;
         virtual void setBit9Rx( uint8_t bit ) override;
 
+        virtual bool saveState( QDataStream& s ) override;
+        virtual bool loadState( QDataStream& s, bool check ) override;
+
     protected:
         int m_number;
 
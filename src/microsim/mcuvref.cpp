@@ -3,6 +3,8 @@
  *                                                                         *
  ***( see copyright.txt file at root folder )*******************************/
 
+#include <QDataStream>
+
 #include "mcuvref.h"
 #include "e_mcu.h"
 
@@ -33,3 +35,26 @@ void McuVref::callBack( McuModule* mod, bool call ) // Add Modules to be called
     { if( !m_callBacks.contains( mod ) ) m_callBacks.append( mod ); }
     else m_callBacks.removeAll( mod );
 }
+
+bool McuVref::saveState( QDataStream& s )
+{
+    saveModule( s );
+    s << m_enabled << m_mode << m_vref;
+    return true;
+}
+
+bool McuVref::loadState( QDataStream& s, bool check )
+{
+    if( !loadModule( s, check ) ) return false;
+
+    bool enabled;
+    uint8_t mode;
+    double vref;
+    s >> enabled >> mode >> vref;
+    if( check || s.status() != QDataStream::Ok ) return s.status() == QDataStream::Ok;
+
+    m_enabled = enabled;
+    m_mode    = mode;
+    m_vref    = vref;
+    return true;
+}
@@ -27,6 +27,9 @@ class McuVref : public McuModule, public eElement
 
         void callBack( McuModule* mod, bool call );
 
+        virtual bool saveState( QDataStream& s ) override;
+        virtual bool loadState( QDataStream& s, bool check ) override;
+
     protected:
         //virtual void setMode( uint8_t mode );
 
@@ -3,6 +3,8 @@
  *                                                                         *
  ***( see copyright.txt file at root folder )*******************************/
 
+#include <QDataStream>
+
 #include "mcuwdt.h"
 #include "e_mcu.h"
 #include "cpubase.h"
@@ -36,3 +38,26 @@ void McuWdt::runEvent()            // Overflow
     Simulator::self()->addEvent( m_ovfPeriod, this );
 }
 
+bool McuWdt::saveState( QDataStream& s )
+{
+    saveModule( s );
+    s << m_wdtFuse << m_ovfInter << m_ovfReset << (quint64)m_ovfPeriod << (quint64)m_clkPeriod;
+    return true;
+}
+
+bool McuWdt::loadState( QDataStream& s, bool check )
+{
+    if( !loadModule( s, check ) ) return false;
+
+    bool wdtFuse, ovfInter, ovfReset;
+    quint64 ovfPeriod, clkPeriod;
+    s >> wdtFuse >> ovfInter >> ovfReset >> ovfPeriod >> clkPeriod;
+    if( check || s.status() != QDataStream::Ok ) return s.status() == QDataStream::Ok;
+
+    m_wdtFuse   = wdtFuse;
+    m_ovfInter  = ovfInter;
+    m_ovfReset  = ovfReset;
+    m_ovfPeriod = ovfPeriod;
+    m_clkPeriod = clkPeriod;
+    return true;
+}
@@ -22,6 +22,9 @@ class McuWdt : public McuPrescaled, public eElement
         virtual void initialize() override;
         virtual void runEvent() override;
 
+        virtual bool saveState( QDataStream& s ) override;
+        virtual bool loadState( QDataStream& s, bool check ) override;
+
         bool enabled() { return m_wdtFuse; }
         void enable( bool en ) { m_wdtFuse = en; }
 
@@ -4,6 +4,7 @@
  ***( see copyright.txt file at root folder )*******************************/
 
 #include <QDebug>
+#include <QHash>
 
 #include "scriptbase.h"
 #include "scriptstdstring.h"
@@ -36,6 +37,9 @@ ScriptBase::ScriptBase( QString name )
 {
     m_aEngine = NULL;
     m_context = NULL;
+    m_built = false;
+    m_buildHash = 0;
+    m_buildSign = 0;
 
     m_aEngine = asCreateScriptEngine();
     if( m_aEngine == 0 ) { qDebug() << "Failed to create script engine."; return; }
@@ -81,12 +85,23 @@ int ScriptBase::compileScript()
 {
     if( !m_aEngine ) return -1;
 
+    uint hash = qHash( m_script );
+    uint sign = engineSignature();
+    asIScriptModule* mod = m_aEngine->GetModule( 0 );
+
+    if( mod && m_built && hash == m_buildHash && sign == m_buildSign ) // Nothing changed: don't build again
+    {
+        mod->ResetGlobalVars( m_context ); // Same state as a fresh build
+        return 0;
+    }
+    m_built = false;
+
     std::string script = m_script.toStdString();
     int len = m_script.size();
 
     m_aEngine->GarbageCollect( asGC_FULL_CYCLE );
 
-    asIScriptModule* mod = m_aEngine->GetModule( 0, asGM_ALWAYS_CREATE );
+    mod = m_aEngine->GetModule( 0, asGM_ALWAYS_CREATE );
     int r = mod->AddScriptSection("script", &script[0], len );
     if( r < 0 ) { qDebug() << "\nScriptBase::compileScript: AddScriptSection() failed\n"; return -1; }
 
@@ -94,9 +109,30 @@ int ScriptBase::compileScript()
     if( r < 0 ) { qDebug() << endl << m_elmId+" ScriptBase::compileScript Error"<< endl; return -1; }
 
     //qDebug() << "\nScriptBase::compileScript: Build() Success\n";
+    m_built = true;
+    m_buildHash = hash;
+    m_buildSign = sign;
     return 0;
 }
 
+uint ScriptBase::engineSignature()
+{
+    uint sign = m_aEngine->GetGlobalFunctionCount();
+    sign = sign*31 + m_aEngine->GetGlobalPropertyCount();
+    sign = sign*31 + m_aEngine->GetEnumCount();
+    sign = sign*31 + m_aEngine->GetFuncdefCount();
+    sign = sign*31 + m_aEngine->GetTypedefCount();
+
+    for( asUINT i=0; i<m_aEngine->GetObjectTypeCount(); ++i )
+    {
+        asITypeInfo* type = m_aEngine->GetObjectTypeByIndex( i );
+        sign = sign*31 + type->GetMethodCount();
+        sign = sign*31 + type->GetPropertyCount();
+        sign = sign*31 + type->GetBehaviourCount();
+    }
+    return sign;
+}
+
 /*int ScriptBase::SaveBytecode(asIScriptEngine *engine, const char *outputFile)
 {
     CBytecodeStream stream;
@@ -33,9 +33,14 @@ class ScriptBase : public eElement
 
     protected:
         void printError( asIScriptContext* context );
+        uint engineSignature(); // Changes if anything is registered in the engine
 
         int m_status;
 
+        bool m_built;      // Module built from current m_script
+        uint m_buildHash;  // Hash of last built script
+        uint m_buildSign;  // Engine signature at last build
+
         QString m_script;
 
         asCJITCompiler* m_jit;
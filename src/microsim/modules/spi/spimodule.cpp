@@ -3,6 +3,8 @@
  *                                                                         *
  ***( see copyright.txt file at root folder )*******************************/
 
+#include <QDataStream>
+
 #include "spimodule.h"
 #include "iopin.h"
 #include "simulator.h"
@@ -85,6 +87,59 @@ void SpiModule::voltChanged() // Called in Slave mode on SCK or SS changes
     step();
 }
 
+bool SpiModule::saveState( QDataStream& s )
+{
+    s << m_clock << (qint32)m_clkState << (quint64)m_clockPeriod;
+    s << m_lsbFirst << m_toggleSck << m_enabled << m_useSS;
+    s << (qint32)m_sampleEdge << (qint32)m_leadEdge << (qint32)m_tailEdge;
+    s << m_outBit << m_inBit << m_bitCount << m_srReg << (qint32)m_mode;
+    s << (m_dataOutPin && m_dataOutPin == m_MISO);
+    return true;
+}
+
+bool SpiModule::loadState( QDataStream& s, bool check )
+{
+    bool clock, lsbFirst, toggleSck, enabled, useSS, dataOutMiso;
+    qint32 clkState, sampleEdge, leadEdge, tailEdge, mode;
+    quint64 clockPeriod;
+    uint8_t outBit, inBit, bitCount, srReg;
+    s >> clock >> clkState >> clockPeriod;
+    s >> lsbFirst >> toggleSck >> enabled >> useSS;
+    s >> sampleEdge >> leadEdge >> tailEdge;
+    s >> outBit >> inBit >> bitCount >> srReg >> mode;
+    s >> dataOutMiso;
+    if( check || s.status() != QDataStream::Ok ) return s.status() == QDataStream::Ok;
+
+    m_clock       = clock;
+    m_clkState    = (clkState_t)clkState;
+    m_clockPeriod = clockPeriod;
+    m_lsbFirst    = lsbFirst;
+    m_toggleSck   = toggleSck;
+    m_useSS       = useSS;
+    m_sampleEdge  = (clkState_t)sampleEdge;
+    m_leadEdge    = (clkState_t)leadEdge;
+    m_tailEdge    = (clkState_t)tailEdge;
+    m_outBit      = outBit;
+    m_inBit       = inBit;
+    m_bitCount    = bitCount;
+    m_srReg       = srReg;
+
+    m_enabled     = enabled;
+    m_mode        = (spiMode_t)mode;
+
+    m_dataOutPin = NULL;
+    m_dataInPin  = NULL;
+    if( m_mode != SPI_OFF )         // Pin states and control are restored by the pins
+    {
+        m_dataOutPin = dataOutMiso ? m_MISO : m_MOSI;
+        m_dataInPin  = dataOutMiso ? m_MOSI : m_MISO;
+    }
+    bool slave = (m_mode == SPI_SLAVE);
+    if( m_clkPin ) m_clkPin->changeCallBack( this, slave );
+    if( m_SS )     m_SS->changeCallBack( this, slave && m_useSS );
+    return true;
+}
+
 void SpiModule::endTransaction()
 {
     if( m_mode == SPI_MASTER ){ if( m_dataOutPin) m_dataOutPin->setOutState( true ); }
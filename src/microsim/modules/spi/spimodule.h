@@ -27,6 +27,9 @@ class SpiModule : public eClockedDevice
         virtual void runEvent() override;
         virtual void voltChanged() override;
 
+        virtual bool saveState( QDataStream& s ) override;
+        virtual bool loadState( QDataStream& s, bool check ) override;
+
         virtual void setMode( spiMode_t mode );
 
         virtual void endTransaction();
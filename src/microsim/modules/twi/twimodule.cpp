@@ -3,9 +3,15 @@
  *                                                                         *
  ***( see copyright.txt file at root folder )*******************************/
 
+#include <QDataStream>
+
 #include "twimodule.h"
 #include "iopin.h"
 #include "simulator.h"
+#include "component.h"
+#include "e-node.h"
+
+QHash<Pin*, TwiModule*> TwiModule::m_slaves;
 
 TwiModule::TwiModule( QString name )
          : eClockedDevice( name )
@@ -15,10 +21,15 @@ TwiModule::TwiModule( QString name )
     m_addrBits = 7;
     m_address = m_cCode = 0;
     m_enabled = true;
+    m_fastSlave = true;
+    m_fastBus = false;
 
     setFreqKHz( 100 );
 }
-TwiModule::~TwiModule( ){}
+TwiModule::~TwiModule()
+{
+    for( Pin* pin : m_slaves.keys( this ) ) m_slaves.remove( pin );
+}
 
 void TwiModule::initialize()
 {
@@ -32,6 +43,7 @@ void TwiModule::initialize()
 
     m_lastSDA = true; // SDA High = inactive
     m_masterACK = true;
+    m_fastBus = false;
 }
 
 void TwiModule::stamp()      // Called at Simulation Start
@@ -40,6 +52,7 @@ void TwiModule::stamp()      // Called at Simulation Start
 void TwiModule::runEvent()
 {
     if( m_mode != TWI_MASTER ) return;
+    if( m_fastBus ) { fastStep(); return; }
 
     updateClock();
     bool clkLow = ((m_clkState == Clock_Low) || (m_clkState == Clock_Falling));
@@ -244,6 +257,73 @@ void TwiModule::voltChanged() // Used by slave
     m_lastSDA = m_sdaState;
 }
 
+bool TwiModule::saveState( QDataStream& s )
+{
+    s << m_clock << (qint32)m_clkState;
+    s << m_cCode << m_address << m_addrBits << m_freq << (quint64)m_clockPeriod;
+    s << m_lastSDA << m_sdaState << m_toggleScl << m_isAddr << m_write << m_sendACK << m_masterACK;
+    s << m_addrMatch << m_genCall << m_enabled << m_fastSlave << m_fastBus;
+    s << m_bitPtr << m_txReg << m_rxReg;
+    s << (qint32)m_mode << (qint32)m_twiState << (qint32)m_nextState << (qint32)m_i2cState << (qint32)m_lastState;
+    return true;
+}
+
+bool TwiModule::loadState( QDataStream& s, bool check )
+{
+    bool clock, lastSDA, sdaState, toggleScl, isAddr, write, sendACK, masterACK;
+    bool addrMatch, genCall, enabled, fastSlave, fastBus;
+    qint32 clkState, mode, twiState, nextState, i2cState, lastState;
+    uint cCode, address;
+    int addrBits, bitPtr;
+    double freq;
+    quint64 clockPeriod;
+    uint8_t txReg, rxReg;
+    s >> clock >> clkState;
+    s >> cCode >> address >> addrBits >> freq >> clockPeriod;
+    s >> lastSDA >> sdaState >> toggleScl >> isAddr >> write >> sendACK >> masterACK;
+    s >> addrMatch >> genCall >> enabled >> fastSlave >> fastBus;
+    s >> bitPtr >> txReg >> rxReg;
+    s >> mode >> twiState >> nextState >> i2cState >> lastState;
+    if( check || s.status() != QDataStream::Ok ) return s.status() == QDataStream::Ok;
+
+    m_clock       = clock;
+    m_clkState    = (clkState_t)clkState;
+    m_cCode       = cCode;
+    m_address     = address;
+    m_addrBits    = addrBits;
+    m_freq        = freq;
+    m_clockPeriod = clockPeriod;
+    m_lastSDA     = lastSDA;
+    m_sdaState    = sdaState;
+    m_toggleScl   = toggleScl;
+    m_isAddr      = isAddr;
+    m_write       = write;
+    m_sendACK     = sendACK;
+    m_masterACK   = masterACK;
+    m_addrMatch   = addrMatch;
+    m_genCall     = genCall;
+    m_enabled     = enabled;
+    m_fastSlave   = fastSlave;
+    m_bitPtr      = bitPtr;
+    m_txReg       = txReg;
+    m_rxReg       = rxReg;
+    m_mode        = (twiMode_t)mode;
+    m_twiState    = (twiState_t)twiState;
+    m_nextState   = (twiState_t)nextState;
+    m_i2cState    = (i2cState_t)i2cState;
+    m_lastState   = (i2cState_t)lastState;
+
+    bool slave = (m_mode == TWI_SLAVE);
+    m_scl->changeCallBack( this, slave );
+    m_sda->changeCallBack( this, slave );
+
+    for( Pin* pin : m_slaves.keys( this ) ) m_slaves.remove( pin );
+    if( slave && m_fastSlave ) m_slaves[m_sda] = this;
+
+    m_fastBus = fastBus && findSlaves(); // Slaves registered at setMode()
+    return true;
+}
+
 void TwiModule::setMode( twiMode_t mode )
 {
     if( mode == TWI_MASTER )
@@ -254,6 +334,10 @@ void TwiModule::setMode( twiMode_t mode )
     m_scl->changeCallBack( this, mode == TWI_SLAVE );
     m_sda->changeCallBack( this, mode == TWI_SLAVE );
 
+    for( Pin* pin : m_slaves.keys( this ) ) m_slaves.remove( pin );
+    if( mode == TWI_SLAVE && m_fastSlave ) m_slaves[m_sda] = this;
+    m_fastBus = false;
+
     if( mode > TWI_OFF )
     {
         m_scl->scheduleState( true, 10000 /*m_clockPeriod/4*/ ); // Avoid false stop condition
@@ -310,6 +394,25 @@ void TwiModule::ACK()
     m_i2cState = I2C_ACK;
 }
 
+void TwiModule::masterStart()
+{
+    bool wasFast = m_fastBus;
+    m_fastBus = findSlaves();
+    m_i2cState = I2C_START;
+
+    if( m_fastBus )
+    {
+        for( TwiModule* slave : m_busSlaves ) // Slaves see a Start Condition
+        {
+            slave->m_bitPtr = 0;
+            slave->m_rxReg = 0;
+            slave->m_i2cState = I2C_START;
+        }
+        fastEvent( 2 );
+    }
+    else if( wasFast ) Simulator::self()->addEvent( m_clockPeriod, this ); // Restart Clock
+}
+
 void TwiModule::masterWrite( uint8_t data , bool isAddr, bool write )
 {
     m_isAddr = isAddr;
@@ -317,6 +420,19 @@ void TwiModule::masterWrite( uint8_t data , bool isAddr, bool write )
 
     m_i2cState = I2C_WRITE;
     m_txReg = data;
+
+    if( m_fastBus )
+    {
+        if( isAddr ){
+            bool ack = addrSlaves( data );
+            if( write ) m_nextState = ack ? TWI_MTX_ADR_ACK : TWI_MTX_ADR_NACK;
+            else        m_nextState = ack ? TWI_MRX_ADR_ACK : TWI_MRX_ADR_NACK;
+        }
+        else m_nextState = writeSlaves( data ) ? TWI_MTX_DATA_ACK : TWI_MTX_DATA_NACK;
+
+        fastEvent( 18 ); // 8 bits + ACK
+        return;
+    }
     writeByte();
 }
 
@@ -324,6 +440,14 @@ void TwiModule::masterRead( bool ack )
 {
     m_sendACK = ack;
 
+    if( m_fastBus )
+    {
+        readSlaves();
+        m_i2cState = I2C_READ;
+        fastEvent( 18 ); // 8 bits + ACK
+        return;
+    }
+
     setSDA( true );
     m_bitPtr = 0;
     m_rxReg = 0;
@@ -336,9 +460,188 @@ void TwiModule::masterRead( bool ack )
 void TwiModule::masterStop()
 {
     m_i2cState = I2C_STOP;
+
+    if( m_fastBus )
+    {
+        for( TwiModule* slave : m_busSlaves ) slave->I2Cstop(); // Slaves see a Stop Condition
+        fastEvent( 2 );
+        return;
+    }
     setSDA( false );
 }
 
+// Transaction level: when the bus is only wired to byte level slaves (and pullups)
+// the master exchanges whole bytes with them, no bits are clocked through Pins.
+
+bool TwiModule::isPullup( Pin* pin ) // Resistor from bus to a Rail or Source
+{
+    for( Pin* rPin : pin->component()->getPins() )
+    {
+        if( rPin == pin ) continue;
+        eNode* node = rPin->getEnode();
+        if( !node ) return false;
+
+        for( ePin* epin : node->getEpins() )
+        {
+            Pin* srcPin = dynamic_cast<Pin*>( epin );
+            if( !srcPin ) continue;
+            QString type = srcPin->component()->itemType();
+            if( type == "Rail" || type == "Fixed Voltage" || type == "Voltage Source" || type == "Battery" ) return true;
+    }   }
+    return false;
+}
+
+bool TwiModule::findSlaves()
+{
+    m_busSlaves.clear();
+
+    eNode* sdaNode = m_sda->getEnode();
+    eNode* sclNode = m_scl->getEnode();
+    if( !sdaNode || !sclNode ) return false;
+
+    for( ePin* epin : sdaNode->getEpins() )
+    {
+        if( epin == m_sda ) continue;
+        Pin* pin = dynamic_cast<Pin*>( epin );
+        if( !pin ) return false;
+
+        QString type = pin->component()->itemType();
+        if( type == "Node" || type == "Tunnel" ) continue;
+        if( type == "Resistor" && isPullup( pin ) ) continue;
+
+        TwiModule* slave = m_slaves.value( pin );
+        if( !slave || slave->m_scl->getEnode() != sclNode ) return false; // Other device or instrument
+        m_busSlaves.append( slave );
+    }
+    int loads = 0;
+    for( ePin* epin : sclNode->getEpins() ) // SCL only wired to the same slaves
+    {
+        if( epin == m_scl ) continue;
+        Pin* pin = dynamic_cast<Pin*>( epin );
+        if( !pin ) return false;
+
+        QString type = pin->component()->itemType();
+        if( type == "Node" || type == "Tunnel" ) continue;
+        if( type == "Resistor" && isPullup( pin ) ) continue;
+        loads++;
+    }
+    return !m_busSlaves.isEmpty() && loads == m_busSlaves.size();
+}
+
+bool TwiModule::addrSlaves( uint8_t data ) // Same as slaves do in voltChanged() after address
+{
+    uint8_t address = data >> 1;
+    bool rw = data & 1;
+    bool ack = false;
+
+    for( TwiModule* slave : m_busSlaves )
+    {
+        if( slave->m_i2cState != I2C_START ) continue;
+
+        slave->m_addrMatch = address == slave->m_address;
+        bool genCall = slave->m_genCall && (address == 0);
+
+        if( !slave->m_addrMatch && !genCall )
+        {
+            slave->m_i2cState = I2C_STOP;
+            slave->m_rxReg = 0;
+            continue;
+        }
+        if( !slave->m_enabled ) continue;
+
+        slave->m_sendACK = true;
+        if( rw )                   // Master is Reading
+        {
+            slave->m_nextState = TWI_STX_ADR_ACK;
+            slave->m_i2cState = I2C_READ;
+            slave->writeByte();
+        }else{                     // Master is Writting
+            slave->m_nextState = slave->m_addrMatch ? TWI_SRX_ADR_ACK : TWI_SRX_GEN_ACK;
+            slave->m_i2cState = I2C_WRITE;
+            slave->m_bitPtr = 0;
+            slave->startWrite();
+        }
+        slave->setTwiState( slave->m_nextState );
+        ack = true;
+    }
+    return ack;
+}
+
+bool TwiModule::writeSlaves( uint8_t data )
+{
+    bool ack = false;
+
+    for( TwiModule* slave : m_busSlaves )
+    {
+        if( slave->m_i2cState != I2C_WRITE ) continue;
+
+        slave->m_rxReg = data;
+        slave->m_bitPtr = 8;
+        if( slave->m_addrMatch )
+             slave->m_nextState = slave->m_sendACK ? TWI_SRX_ADR_DATA_ACK : TWI_SRX_ADR_DATA_NACK;
+        else slave->m_nextState = slave->m_sendACK ? TWI_SRX_GEN_DATA_ACK : TWI_SRX_GEN_DATA_NACK;
+
+        slave->readByte();                         // Slave gets the byte and sets ACK
+        slave->m_i2cState = slave->m_lastState;    // ACK done
+        slave->m_rxReg = 0;
+        slave->setTwiState( slave->m_nextState );
+
+        if( slave->m_sendACK ) ack = true;
+    }
+    return ack;
+}
+
+void TwiModule::readSlaves()
+{
+    m_rxReg = 0xFF; // Nobody driving SDA: pullups
+
+    for( TwiModule* slave : m_busSlaves )
+    {
+        if( slave->m_i2cState != I2C_READ ) continue;
+
+        m_rxReg = slave->m_txReg;
+        break;
+    }
+}
+
+void TwiModule::ackSlaves() // Slave sees Master ACK/NACK after the byte it sent
+{
+    for( TwiModule* slave : m_busSlaves )
+    {
+        if( slave->m_i2cState != I2C_READ ) continue;
+
+        slave->setTwiState( m_sendACK ? TWI_STX_DATA_ACK : TWI_STX_DATA_NACK );
+        if( m_sendACK ) slave->writeByte(); // ACK: Continue Sending
+        else            slave->m_i2cState = I2C_IDLE;
+        break;
+    }
+}
+
+void TwiModule::fastEvent( int halfClocks )
+{
+    Simulator::self()->cancelEvents( this );
+    Simulator::self()->addEvent( halfClocks*m_clockPeriod, this );
+}
+
+void TwiModule::fastStep() // Transaction finished
+{
+    switch( m_i2cState )
+    {
+        case I2C_START: setTwiState( TWI_START ); break;
+        case I2C_WRITE: bufferEmpty(); setTwiState( m_nextState ); break;
+        case I2C_READ:  readByte();     // Sets I2C_ACK state
+        case I2C_ACK:
+        {
+            if( !m_masterACK ){ m_i2cState = I2C_ACK; fastEvent( 2 ); return; } // PICs send Master ACK as separate action
+            ackSlaves();  // ACK may have changed since masterRead()
+            setTwiState( m_sendACK ? TWI_MRX_DATA_ACK : TWI_MRX_DATA_NACK );
+        }break;
+        case I2C_STOP:  setTwiState( TWI_NO_STATE ); break;
+        default: return;
+    }
+    m_i2cState = I2C_IDLE;
+}
+
 void TwiModule::slaveWrite()
 {
     m_bitPtr = 7;// Start Slave transmission
@@ -6,6 +6,8 @@
 #ifndef TWIMODULE_H
 #define TWIMODULE_H
 
+#include <QHash>
+
 #include "e-clocked_device.h"
 #include "avrtwicodes.h" // Using AVR states comes at hand
 
@@ -16,6 +18,7 @@ enum twiMode_t{
 };
 
 class eSource;
+class Pin;
 
 class TwiModule : public eClockedDevice
 {
@@ -39,6 +42,9 @@ class TwiModule : public eClockedDevice
         virtual void runEvent() override;
         virtual void voltChanged() override;
 
+        virtual bool saveState( QDataStream& s ) override;
+        virtual bool loadState( QDataStream& s, bool check ) override;
+
         int cCode() { return m_cCode; }
         void setCcode( int code ) { m_cCode = m_address = code; }
 
@@ -56,7 +62,7 @@ class TwiModule : public eClockedDevice
         void setSclPin( IoPin* pin );
         virtual void setMode( twiMode_t mode );
 
-        void masterStart() { m_i2cState = I2C_START; }
+        void masterStart();
         void masterWrite( uint8_t data, bool isAddr, bool write );
         void masterRead( bool ack );
         void masterStop();
@@ -76,6 +82,15 @@ class TwiModule : public eClockedDevice
 
         virtual void setTwiState( twiState_t state ) { m_twiState = state; }
 
+        bool isPullup( Pin* pin );
+        bool findSlaves();
+        bool addrSlaves( uint8_t data );
+        bool writeSlaves( uint8_t data );
+        void readSlaves();
+        void ackSlaves();
+        void fastEvent( int halfClocks );
+        void fastStep();
+
         uint m_cCode;
         uint m_address;           // Device Address
         int  m_addrBits;
@@ -93,6 +108,8 @@ class TwiModule : public eClockedDevice
         bool m_addrMatch;
         bool m_genCall;
         bool m_enabled;
+        bool m_fastSlave; // Can exchange whole bytes with a master
+        bool m_fastBus;   // Master exchanging whole bytes, no Pins driven
 
         int m_bitPtr;       // Bit Pointer
 
@@ -107,6 +124,10 @@ class TwiModule : public eClockedDevice
 
         IoPin* m_sda;
         IoPin* m_scl;
+
+        QList<TwiModule*> m_busSlaves; // Slaves in this bus (master)
+
+ static QHash<Pin*, TwiModule*> m_slaves; // Byte level slaves by SDA Pin
 };
 
 #endif
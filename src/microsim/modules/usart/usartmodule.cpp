@@ -4,6 +4,7 @@
  ***( see copyright.txt file at root folder )*******************************/
 
 #include <math.h>
+#include <QDataStream>
 
 #include "usartmodule.h"
 #include "usarttx.h"
@@ -110,6 +111,40 @@ void UartTR::configureA( uint8_t val ) // Select Pin
     if( pinNum < m_pinList.size() ) m_ioPin = m_pinList.at( pinNum );
 }
 
+bool UartTR::saveState( QDataStream& s )
+{
+    saveModule( s );
+    s << (qint32)m_pinList.indexOf( m_ioPin ) << m_buffer << m_data << m_frame << m_framesize;
+    s << m_currentBit << m_bit9 << (qint32)m_state << m_enabled << (quint64)m_period;
+    return true;
+}
+
+bool UartTR::loadState( QDataStream& s, bool check )
+{
+    if( !loadModule( s, check ) ) return false;
+
+    qint32 pinIndex, state;
+    uint8_t buffer, data, framesize, currentBit, bit9;
+    uint16_t frame;
+    bool enabled;
+    quint64 period;
+    s >> pinIndex >> buffer >> data >> frame >> framesize;
+    s >> currentBit >> bit9 >> state >> enabled >> period;
+    if( check || s.status() != QDataStream::Ok ) return s.status() == QDataStream::Ok;
+
+    if( pinIndex >= 0 && pinIndex < m_pinList.size() ) m_ioPin = m_pinList.at( pinIndex );
+    m_buffer     = buffer;
+    m_data       = data;
+    m_frame      = frame;
+    m_framesize  = framesize;
+    m_currentBit = currentBit;
+    m_bit9       = bit9;
+    m_state      = (state_t)state;
+    m_enabled    = enabled;
+    m_period     = period;
+    return true;
+}
+
 bool UartTR::getParity( uint16_t data )
 {
     bool parity = false;
@@ -28,6 +28,7 @@ enum rxError_t{
     parityError=1<<14
 };
 
+class Pin;
 class IoPin;
 class UartTx;
 class UartRx;
@@ -104,9 +105,13 @@ class UartTR : public McuModule, public eElement
 
         virtual void configureA( uint8_t val ) override;
 
+        virtual bool saveState( QDataStream& s ) override;
+        virtual bool loadState( QDataStream& s, bool check ) override;
+
         bool isEnabled() { return m_enabled; }
 
         void setPeriod( uint64_t period ) { m_period = period; }
+        uint64_t period() { return m_period; }
         bool getParity( uint16_t data );
 
         state_t state() { return m_state; }
@@ -3,12 +3,16 @@
  *                                                                         *
  ***( see copyright.txt file at root folder )*******************************/
 
+#include <QDataStream>
+
 #include "usartrx.h"
 #include "mcuinterrupts.h"
 #include "iopin.h"
 #include "simulator.h"
 #include "connector.h"
 
+QHash<Pin*, UartRx*> UartRx::m_rxPins;
+
 UartRx::UartRx( UsartModule* usart, eMcu* mcu, QString name )
       : UartTR( usart, mcu, name )
 {
@@ -16,7 +20,10 @@ UartRx::UartRx( UsartModule* usart, eMcu* mcu, QString name )
     m_fifoSize = 2;
     m_ignoreData = false;
 }
-UartRx::~UartRx( ){}
+UartRx::~UartRx()
+{
+    for( Pin* pin : m_rxPins.keys( this ) ) m_rxPins.remove( pin );
+}
 
 void UartRx::enable( uint8_t en )
 {
@@ -31,15 +38,47 @@ void UartRx::enable( uint8_t en )
         m_currentBit = 0;
         m_fifoP = -1;
         m_startHigh = m_ioPin->getInpState();
+        m_rxPins[m_ioPin] = this;
     }else{
         m_state = usartSTOPPED;
         Simulator::self()->cancelEvents( this );
+        for( Pin* pin : m_rxPins.keys( this ) ) m_rxPins.remove( pin );
     }
 
     m_ioPin->changeCallBack( this, enabled );  // Wait for start bit if enabled
     m_frame = 0;
 }
 
+bool UartRx::saveState( QDataStream& s )
+{
+    UartTR::saveState( s );
+    s << m_startHigh << m_ignoreData << m_fifo[0] << m_fifo[1] << m_fifoP << m_fifoSize;
+    return true;
+}
+
+bool UartRx::loadState( QDataStream& s, bool check )
+{
+    if( !UartTR::loadState( s, check ) ) return false;
+
+    bool startHigh, ignoreData;
+    uint16_t fifo0, fifo1;
+    int fifoP, fifoSize;
+    s >> startHigh >> ignoreData >> fifo0 >> fifo1 >> fifoP >> fifoSize;
+    if( check || s.status() != QDataStream::Ok ) return s.status() == QDataStream::Ok;
+
+    m_startHigh  = startHigh;
+    m_ignoreData = ignoreData;
+    m_fifo[0]    = fifo0;
+    m_fifo[1]    = fifo1;
+    m_fifoP      = fifoP;
+    m_fifoSize   = fifoSize;
+
+    for( Pin* pin : m_rxPins.keys( this ) ) m_rxPins.remove( pin );
+    if( m_enabled ) m_rxPins[m_ioPin] = this;
+    m_ioPin->changeCallBack( this, m_enabled && m_state != usartRECEIVE ); // Waiting for start bit
+    return true;
+}
+
 void UartRx::voltChanged()
 {
     if( !m_enabled || m_sleeping ) return;
@@ -77,6 +116,19 @@ void UartRx::readBit()
     else if( m_period ) Simulator::self()->addEvent( m_period, this );
 }
 
+void UartRx::receiveFrame( uint16_t frame, uint8_t size ) // Whole frame from a directly wired UartTx
+{
+    if( !m_enabled || m_sleeping ) return;
+
+    uint16_t rxFrame = 0;
+    for( int i=1; i<m_framesize; ++i ) // Sample bits as readBit() would do (line is high after frame)
+    {
+        bool bit = (i < size) ? (frame>>i) & 1 : true;
+        if( bit ) rxFrame += 1<<i;
+    }
+    byteReceived( rxFrame >> 1 ); // Remove Start bit
+}
+
 void UartRx::rxEnd()
 {
     m_currentBit = 0;
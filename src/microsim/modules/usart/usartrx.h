@@ -7,6 +7,7 @@
 #define USARTRX_H
 
 #include <queue>
+#include <QHash>
 
 #include "usartmodule.h"
 
@@ -21,9 +22,16 @@ class UartRx : public UartTR
         virtual void runEvent() override;
         virtual uint8_t getData() override;
 
+        virtual bool saveState( QDataStream& s ) override;
+        virtual bool loadState( QDataStream& s, bool check ) override;
+
         void ignoreData( bool i ) {m_ignoreData = i; }
         void setFifoSize( uint8_t s ) { m_fifoSize = s; }
 
+        void receiveFrame( uint16_t frame, uint8_t size );
+
+ static UartRx* rxAtPin( Pin* pin ) { return m_rxPins.value( pin ); }
+
     protected:
         void setRxFlags();
         void readBit();
@@ -36,6 +44,8 @@ class UartRx : public UartTR
         uint16_t m_fifo[2];
         int  m_fifoP;
         int  m_fifoSize;
+
+ static QHash<Pin*, UartRx*> m_rxPins; // Enabled receivers by input Pin
 };
 
 #endif
@@ -3,7 +3,10 @@
  *                                                                         *
  ***( see copyright.txt file at root folder )*******************************/
 
+#include <QDataStream>
+
 #include "usarttx.h"
+#include "usartrx.h"
 #include "mcuinterrupts.h"
 #include "iopin.h"
 #include "simulator.h"
@@ -12,6 +15,7 @@ UartTx::UartTx( UsartModule* usart, eMcu* mcu, QString  name )
       : UartTR( usart, mcu, name )
 {
     m_period = 0;
+    m_rxPeer = NULL;
 }
 UartTx::~UartTx( ){}
 
@@ -37,11 +41,35 @@ void UartTx::runEvent()
     }
     else if( m_state == usartTXEND )
     {
+        if( m_rxPeer ){
+            m_rxPeer->receiveFrame( m_frame, m_framesize );
+            m_rxPeer = NULL;
+        }
         m_state = usartIDLE;
         m_ioPin->setOutState( true );
         m_usart->frameSent( m_data );
 }   }
 
+bool UartTx::saveState( QDataStream& s )
+{
+    UartTR::saveState( s );
+    s << ( m_rxPeer != NULL );
+    return true;
+}
+
+bool UartTx::loadState( QDataStream& s, bool check )
+{
+    if( !UartTR::loadState( s, check ) ) return false;
+
+    bool rxPeer;
+    s >> rxPeer;
+    if( check || s.status() != QDataStream::Ok ) return s.status() == QDataStream::Ok;
+
+    Pin* pin = m_ioPin->linkedPin();   // Frame in flight to a directly wired receiver
+    m_rxPeer = ( rxPeer && pin ) ? UartRx::rxAtPin( pin ) : NULL;
+    return true;
+}
+
 void UartTx::processData( uint8_t data )
 {
     m_buffer = data;
@@ -78,8 +106,25 @@ void UartTx::startTransmission() // Data loaded to ShiftReg
         m_framesize++;
     }
     m_currentBit = 0;
-    if( m_period ) sendBit(); // Start transmission
+    if( !m_period ) return;
+
+    m_rxPeer = directRx();
+    if( m_rxPeer ){                      // Deliver whole frame when transmission ends
+        m_state = usartTXEND;
+        Simulator::self()->addEvent( m_framesize*m_period, this );
+    }
+    else sendBit(); // Start transmission
+}
+
+UartRx* UartTx::directRx() // Receiver wired only to this Tx at same baudrate
+{
+    Pin* pin = m_ioPin->linkedPin();
+    if( !pin ) return NULL;
 
+    UartRx* rx = UartRx::rxAtPin( pin );
+    if( !rx || !rx->isEnabled() || rx->getPin() != pin ) return NULL;
+    if( rx->state() != usartIDLE || rx->period() != m_period ) return NULL;
+    return rx;
 }
 
 void UartTx::sendBit()
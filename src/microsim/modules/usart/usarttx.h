@@ -17,11 +17,17 @@ class UartTx : public UartTR
         virtual void enable( uint8_t en ) override;
         virtual void runEvent() override;
 
+        virtual bool saveState( QDataStream& s ) override;
+        virtual bool loadState( QDataStream& s, bool check ) override;
+
         void processData( uint8_t data );
         void startTransmission();
 
     protected:
         void sendBit();
+        UartRx* directRx();
+
+        UartRx* m_rxPeer; // Receiving whole frames, no bits through Pins
 };
 
 #endif
@@ -4,18 +4,22 @@
  ***( see copyright.txt file at root folder )*******************************/
 
 #include <iostream>
+#include <string.h>
 #include <QtMath>
 //#include <iomanip> // setw()
 
 #include "circmatrix.h"
 #include "simulator.h"
 
-CircMatrix* CircMatrix::m_pSelf = 0l;
+#define cacheMinSize  6        // Smaller groups are factored faster than looked up
+#define cacheDepth    8        // Factorizations kept per group
+#define cacheMaxMiss  (4*cacheDepth) // Consecutive misses before disabling group cache
+#define cacheMaxBytes (32<<20) // Memory for all cached factorizations
 
 CircMatrix::CircMatrix()
 {
-    m_pSelf = this;
     m_numEnodes = 0;
+    m_cacheBytes = 0;
 }
 CircMatrix::~CircMatrix(){}
 
@@ -58,6 +62,8 @@ void CircMatrix::analyze()
 
     m_aList.clear();
     m_aFaList.clear();
+    m_factorCache.clear();
+    m_cacheBytes = 0;
     m_bList.clear();
     m_eNodeActList.clear();
     int group = 0;
@@ -103,6 +109,9 @@ void CircMatrix::analyze()
             }
             m_aList.append( a );
             m_aFaList.append( ap );
+            uint64_t factorBytes = 2*numEnodes*numEnodes*sizeof(double);
+            bool cached = numEnodes >= cacheMinSize && factorBytes <= cacheMaxBytes;
+            m_factorCache.append( { QList<factor_t>(), 0, cached } );
             m_bList.append( b );
             m_eNodeActList.append( eNodeActive );
             group++;
@@ -125,7 +134,7 @@ bool CircMatrix::solveMatrix()
         m_eNodeActive = &(m_eNodeActList[i]);
         int n = m_eNodeActive->size();
 
-        if( m_admitChanged[i] ) factorMatrix( n, i );
+        if( m_admitChanged[i] && !factorCached( n, i ) ) factorMatrix( n, i );
         if( !luSolve( n, i ) ) ok = false;
 
         m_currChanged[i]  = false;
@@ -177,6 +186,62 @@ void CircMatrix::factorMatrix( int n, int group ) // Factor matrix into Lower/Up
     }*/
 }
 
+// Switching circuits (multiplexed displays, bridges, relays) cycle through a few
+// admittance patterns: keep recent factorizations and reuse them when a pattern repeats.
+// Nonlinear groups change admittances at every iteration: cache is disabled after some misses.
+bool CircMatrix::factorCached( int n, int group )
+{
+    cache_t& cache = m_factorCache[group];
+    if( !cache.enabled ) return false;
+
+    const dp_matrix_t& ap = m_aList[group];
+    d_vector_t admit( n*n );
+    uint64_t hash = 14695981039346656037ULL; // FNV-1a
+    int i = 0;
+    for( int row=0; row<n; ++row )
+    {
+        for( int col=0; col<n; ++col )
+        {
+            double value = *(ap[row][col]);
+            admit[i++] = value;
+            uint64_t bits;
+            memcpy( &bits, &value, sizeof(bits) );
+            hash = (hash ^ bits)*1099511628211ULL;
+    }   }
+    QList<factor_t>& factors = cache.factors;
+    for( int j=0; j<factors.size(); ++j )
+    {
+        if( factors.at( j ).hash != hash || factors.at( j ).admit != admit ) continue;
+
+        if( j > 0 ) factors.move( j, 0 ); // Most recently used first
+        m_aFaList[group] = factors.first().lu;
+        cache.misses = 0;
+        return true;
+    }
+    uint64_t factorBytes = 2*n*n*sizeof(double);
+
+    if( ++cache.misses > cacheMaxMiss ) // Admittances don't repeat: stop caching this group
+    {
+        m_cacheBytes -= factors.size()*factorBytes;
+        factors.clear();
+        cache.enabled = false;
+        return false;
+    }
+    factorMatrix( n, group );
+
+    if( factors.size() >= cacheDepth )
+    {
+        factors.removeLast();
+        m_cacheBytes -= factorBytes;
+    }
+    if( m_cacheBytes+factorBytes > cacheMaxBytes ) return true; // Memory limit: don't store
+
+    factor_t factor = { hash, admit, m_aFaList[group] };
+    factors.prepend( factor );
+    m_cacheBytes += factorBytes;
+    return true;
+}
+
 bool CircMatrix::luSolve( int n, int group ) // Solves the system to get voltages for each node
 {
     const d_matrix_t&  a  = m_aFaList[group];
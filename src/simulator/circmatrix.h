@@ -7,6 +7,7 @@
 #define CIRCMATRIX_H
 
 #include <vector>
+#include <stdint.h>
 #include <QList>
 
 #include "e-node.h"
@@ -18,12 +19,21 @@ class CircMatrix
     typedef std::vector<d_vector_t>  d_matrix_t;
     typedef std::vector<dp_vector_t> dp_matrix_t;
 
+    struct factor_t{         // Factored matrix for an admittance pattern
+        uint64_t   hash;
+        d_vector_t admit;
+        d_matrix_t lu;
+    };
+    struct cache_t{          // Recent factorizations of a group
+        QList<factor_t> factors; // Newest first
+        int  misses;             // Consecutive lookups not found
+        bool enabled;
+    };
+
     public:
         CircMatrix();
         ~CircMatrix();
 
- static CircMatrix* self() { return m_pSelf; }
-
         void createMatrix( QList<eNode*> &eNodeList );
         bool solveMatrix();
 
@@ -40,12 +50,11 @@ class CircMatrix
         }
 
     private:
- static CircMatrix* m_pSelf;
-
         void analyze();
         void addConnections( int enodNum, QList<int>* nodeGroup, QList<int>* allNodes );
 
         inline void factorMatrix( int n, int group );
+        inline bool factorCached( int n, int group ); // False if group not cached, else m_aFaList is factored
         inline bool luSolve( int n, int group );
 
         int m_numEnodes;
@@ -53,6 +62,8 @@ class CircMatrix
 
         QList<dp_matrix_t> m_aList;
         QList<d_matrix_t>  m_aFaList;
+        QList<cache_t>     m_factorCache;
+        uint64_t           m_cacheBytes;  // Memory used by all cached factorizations
         QList<dp_vector_t> m_bList;
 
         std::vector<bool>    m_admitChanged;
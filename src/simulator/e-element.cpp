@@ -3,6 +3,8 @@
  *                                                                         *
  ***( see copyright.txt file at root folder )*******************************/
 
+#include <QtMath>
+
 #include "e-element.h"
 #include "simulator.h"
 #include "e-pin.h"
@@ -58,3 +60,22 @@ void eElement::resumeEvents()
     Simulator::self()->addEvent( m_pendingTime, this );
     m_pendingTime = 0;
 }
+
+double eElement::limitPnStep( double vnew, double vold, double vt, double vcrit )
+{
+    if( vnew > vcrit && qFabs( vnew-vold ) > 2*vt ) // Current would change by more than e^2
+    {
+        if( vold > 0 ){
+            double arg = 1+(vnew-vold)/vt;
+            if( arg > 0 ) vnew = vold + vt*qLn( arg );
+            else          vnew = vcrit;
+        }
+        else vnew = vt*qLn( vnew/vt );
+    }
+    return vnew;
+}
+
+bool eElement::currConverged( double curr, double linCurr ) // linCurr: last current + admit*(vnew-vold)
+{
+    return qFabs( curr-linCurr ) <= 1e-3*qFabs( linCurr )+1e-12; // Relative + absolute tolerance
+}
@@ -10,6 +10,7 @@
 #include <QString>
 
 class ePin;
+class QDataStream;
 
 class eElement
 {
@@ -23,6 +24,9 @@ class eElement
         virtual void runEvent(){;}
         virtual void voltChanged(){;}
 
+        virtual bool saveState( QDataStream& ){ return false; } // Simulation checkpoint: false if not supported
+        virtual bool loadState( QDataStream&, bool ){ return false; } // check: only validate data
+
         virtual void setNumEpins( int n );
 
         virtual ePin* getEpin( int num );
@@ -33,6 +37,10 @@ class eElement
         void pauseEvents();
         void resumeEvents();
 
+        // Non linear elements:
+ static double limitPnStep( double vnew, double vold, double vt, double vcrit ); // Junction voltage damping
+ static bool   currConverged( double curr, double linCurr ); // Residual against linearized current within tolerance
+
         static constexpr double cero_doub = 1e-14;
         static constexpr double high_imp  = 1e14;
 
@@ -172,7 +172,7 @@ void eNode::changed()
     Simulator::self()->addToChangedNodes( this );
 }
 
-void eNode::stampMatrix()
+void eNode::stampMatrix( CircMatrix* matrix )
 {
     if( m_nodeNum == 0 ) return;
     m_changed = false;
@@ -204,7 +204,7 @@ void eNode::stampMatrix()
                 m_totalAdmit += adm;    // Calculate total admitance
                 conn = conn->next;
             }
-            CircMatrix::self()->stampDiagonal( m_nodeGroup, m_nodeNum, m_totalAdmit ); // Stamp diagonal
+            matrix->stampDiagonal( m_nodeGroup, m_nodeNum, m_totalAdmit ); // Stamp diagonal
 
             conn = m_firstSingAdm;      // Single admitance values
             while( conn ){
@@ -224,7 +224,7 @@ void eNode::stampMatrix()
             while( na ){                  // Stamp non diagonal
                 int    enode = na->node;
                 double admit = na->value;
-                if( enode > 0 ) CircMatrix::self()->stampMatrix( m_nodeNum, enode, -admit );
+                if( enode > 0 ) matrix->stampMatrix( m_nodeNum, enode, -admit );
                 na = na->next;
             }
         }
@@ -236,7 +236,7 @@ void eNode::stampMatrix()
         Connection* conn = m_firstCurrent;
         while( conn ){ m_totalCurr += conn->value; conn = conn->next; } // Calculate total current
 
-        if( !m_single ) CircMatrix::self()->stampCoef(  m_nodeGroup, m_nodeNum, m_totalCurr );
+        if( !m_single ) matrix->stampCoef(  m_nodeGroup, m_nodeNum, m_totalCurr );
         m_currChanged  = false;
     }
     if( m_single ) solveSingle();
@@ -251,9 +251,9 @@ void eNode::solveSingle()
     setVolt( volt );
 }
 
-void  eNode::setVolt( double v )
+void  eNode::setVolt( double v, bool force )
 {
-    if( m_volt == v ) return;
+    if( m_volt == v && !force ) return;
 
     m_voltChanged = true; // Used for wire animation
     m_volt = v;
@@ -10,6 +10,7 @@
 
 class ePin;
 class eElement;
+class CircMatrix;
 
 class eNode
 {
@@ -44,12 +45,12 @@ class eNode
         void setNodeGroup( int n ){ m_nodeGroup = n; }
 
         double getVolt() { return m_volt; }
-        void   setVolt( double volt );
+        void   setVolt( double volt, bool force=false ); // force: call Elements even if Volt didn't change
         //bool voltchanged() { return m_voltChanged; }
         //void setVoltChanged( bool changed ){ m_voltChanged = changed; }
 
         void initialize();
-        void stampMatrix();
+        void stampMatrix( CircMatrix* matrix );
 
         void setSingle( bool single ) { m_single = single; } // This eNode can calculate it's own Volt
         //void setSwitched( bool switched ){ m_switched = switched; } // This eNode has switches attached
@@ -24,6 +24,9 @@ eBJT::eBJT( QString id )
 
     m_PNP = false;
     m_baseCurr = 0;
+    m_collCurr = 0;
+    m_emitCurr = 0;
+    m_Gee = m_Gcc = m_Gce = m_Gec = 0;
 
     m_gain = 100;
     m_rgain = .5;
@@ -51,6 +54,9 @@ void eBJT::initialize()
     m_voltBE = 0;
     m_voltBC = 0;
     m_baseCurr = 0;
+    m_collCurr = 0;
+    m_emitCurr = 0;
+    m_Gee = m_Gcc = m_Gce = m_Gec = 0;
 }
 
 void eBJT::stamp()
@@ -93,28 +99,49 @@ void eBJT::voltChanged()
     double voltBC = voltB-voltC;
     double voltBE = voltB-voltE;
 
+    double pcoef = pnp/m_vt;
+    double expBC = 0;
+    double expBE = 0;
+    double voltBCin = voltBC;
+    double voltBEin = voltBE;
+    bool evaluated = false;
+
     if( m_changed ) m_changed = false;
     else if( qFabs(voltBC-m_voltBC) < .01
           && qFabs(voltBE-m_voltBE) < .01 )
         { m_step = 0; return; }
+    else{                                  // Check current residuals
+        expBC = qExp( voltBC*pcoef );
+        expBE = qExp( voltBE*pcoef );
+        double ie = pnp*m_satCur*(-(expBE-1)/m_fgain + (expBC-1) );
+        double ic = pnp*m_satCur*( (expBE-1) - (expBC-1)/m_rgain );
+        double dVBC = voltBC-m_voltBC;
+        double dVBE = voltBE-m_voltBE;
+        double icLin = m_collCurr + m_Gce*dVBE + m_Gcc*dVBC; // Currents solved by the Matrix
+        double ieLin = m_emitCurr + m_Gee*dVBE + m_Gec*dVBC;
+        if( currConverged( ic, icLin )
+         && currConverged( ie, ieLin ) ) { m_step = 0; return; }
+        evaluated = true;
+    }
     Simulator::self()->notCorverged();
 
     m_step += .1;
     double gmin = m_satCur*1e-2*qExp( m_step );
     if( gmin > .1 ) gmin = .1;
 
-    voltBC = pnp*limitStep( pnp*voltBC, pnp*m_voltBC );
+    voltBC = pnp*limitPnStep( pnp*voltBC, pnp*m_voltBC, m_vt, m_vCrit );
     m_voltBC = voltBC;
-    voltBE = pnp*limitStep( pnp*voltBE, pnp*m_voltBE );
+    voltBE = pnp*limitPnStep( pnp*voltBE, pnp*m_voltBE, m_vt, m_vCrit );
     m_voltBE = voltBE;
 
-    double pcoef = pnp/m_vt;
-    double expBC = qExp( voltBC*pcoef );
-    double expBE = qExp( voltBE*pcoef );
+    if( !evaluated || voltBC != voltBCin ) expBC = qExp( voltBC*pcoef ); // Reuse if not limited
+    if( !evaluated || voltBE != voltBEin ) expBE = qExp( voltBE*pcoef );
 
     double ie = pnp*m_satCur*(-(expBE-1)/m_fgain + (expBC-1) );
     double ic = pnp*m_satCur*( (expBE-1) - (expBC-1)/m_rgain );
     m_baseCurr = -(ie+ic);
+    m_collCurr = ic;
+    m_emitCurr = ie;
 
     double Gee = -m_satCur/m_vt*expBE/m_fgain;
     double Gcc = -m_satCur/m_vt*expBC/m_rgain;
@@ -124,6 +151,11 @@ void eBJT::voltChanged()
     Gcc -= gmin;
     Gee -= gmin;
 
+    m_Gee = Gee;
+    m_Gcc = Gcc;
+    m_Gce = Gce;
+    m_Gec = Gec;
+
     // Admitance Matrix OK
     m_BC->stampAdmitance(-Gec-Gcc );
     m_CB->stampAdmitance(-Gce-Gcc );
@@ -137,19 +169,6 @@ void eBJT::voltChanged()
     EMIT->stampCurrent(-ie + Gee*voltBE + Gec*voltBC );
 }
 
-double eBJT::limitStep( double vnew, double vold )
-{
-    if( vnew > m_vCrit && qFabs(vnew-vold) > (2*m_vt) ){
-        if( vold > 0 ){
-            double arg = 1+(vnew-vold)/m_vt;
-            if( arg > 0 )  vnew = vold + m_vt*qLn( arg );
-            else           vnew = m_vCrit;
-        }
-        else vnew = m_vt*qLn( vnew/m_vt );
-    }
-    return vnew;
-}
-
 void eBJT::setGain( double gain )
 {
     m_gain = gain;
@@ -18,6 +18,8 @@ class eBJT : public eElement
         virtual void initialize() override;
         virtual void stamp() override;
         virtual void voltChanged() override;
+        virtual bool saveState( QDataStream& ) override { return true; }
+        virtual bool loadState( QDataStream&, bool ) override { return true; }
 
         double gain() { return m_gain; }
         void setGain( double gain );
@@ -29,11 +31,15 @@ class eBJT : public eElement
         void   setThreshold( double vCrit );
 
     protected:
-        double limitStep( double vnew, double vold );
-
         double m_baseCurr;
+        double m_collCurr;
+        double m_emitCurr;
         double m_voltBE;
         double m_voltBC;
+        double m_Gee;  // Conductances of last linearization
+        double m_Gcc;
+        double m_Gce;
+        double m_Gec;
         double m_gain;
         double m_vt;
         double m_satCur;
@@ -51,9 +51,17 @@ void eDiode::stamp()
 void eDiode::voltChanged()
 {
     double voltPN = m_ePin[0]->getVoltage() - m_ePin[1]->getVoltage();
+    double current, admit;
+    bool evaluated = false;
 
     if( m_changed ) m_changed = false;
     else if( qFabs( voltPN - m_voltPN ) < .01 ) { m_step = 0; m_converged = true; return; } // Converged
+    else{
+        evaluate( voltPN, &current, &admit );
+        double linCurr = m_current + m_admit*(voltPN-m_voltPN); // Current solved by the Matrix
+        if( currConverged( current, linCurr ) ) { m_step = 0; m_converged = true; return; }
+        evaluated = true;
+    }
     m_converged = false;
     Simulator::self()->notCorverged();
 
@@ -61,32 +69,20 @@ void eDiode::voltChanged()
     double gmin = m_bAdmit*qExp( m_step );
     if( gmin > .1 ) gmin = .1;
 
-    if( voltPN > m_vCriti && qFabs(voltPN - m_voltPN) > m_vScale*2 ) // check new voltage; has current changed by factor of e^2?
-    {
-        voltPN = limitStep( voltPN, m_voltPN, m_vScale, m_vCriti );
-    }
-    else if( m_bkDown != 0 && voltPN < 0 )
+    double voltIn = voltPN;
+    if( voltPN > 0 || m_bkDown == 0 ) voltPN = limitPnStep( voltPN, m_voltPN, m_vScale, m_vCriti );
+    else                                   // Zener breakdown region
     {
         voltPN = -voltPN - m_zOfset;
         double vold = -m_voltPN - m_zOfset;
-
-        if( voltPN > m_vzCrit && qFabs(voltPN - vold) > m_vt*2 )
-            voltPN = limitStep( voltPN, vold, m_vt, m_vzCrit );
-        voltPN = -(voltPN+m_zOfset);
+        voltPN = -(limitPnStep( voltPN, vold, m_vt, m_vzCrit )+m_zOfset);
     }
     m_voltPN = voltPN;
 
-    double eval = qExp( voltPN*m_vdCoef );
+    if( !evaluated || voltPN != voltIn ) evaluate( voltPN, &current, &admit ); // Reuse if not limited
 
-    if( m_bkDown == 0 || voltPN >= 0  )  // No breakdown Diode or Forward biased Zener
-    {
-        m_admit   = m_satCur * m_vdCoef*eval + gmin;
-        m_current = m_satCur * (eval-1);
-    }else{                               // Reverse biased Zener or Diode with breakdown
-        double expCoef = qExp( (-voltPN-m_zOfset)*m_vzCoef );
-        m_admit   = m_satCur * ( m_vdCoef*eval + m_vzCoef*expCoef ) + gmin;
-        m_current = m_satCur * ( eval-1 - expCoef ) ;
-    }
+    m_admit   = admit + gmin;
+    m_current = current;
     eResistor::stampAdmit();
 
     double stCurr = m_current - m_admit*voltPN;
@@ -94,16 +90,19 @@ void eDiode::voltChanged()
     m_ePin[1]->stampCurrent( stCurr );
 }
 
-inline double eDiode::limitStep( double vnew, double vold, double scale, double vc )
+inline void eDiode::evaluate( double voltPN, double* current, double* admit ) // Current and conductance at voltPN
 {
-    if( vold > 0 )
-    {
-        double arg = 1 + (vnew-vold)/scale;
-        if( arg > 0 ) vnew = vold + scale*qLn( arg );
-        else          vnew = vc;
-    }else             vnew = scale*qLn( vnew/scale );
+    double eval = qExp( voltPN*m_vdCoef );
 
-    return vnew;
+    if( m_bkDown == 0 || voltPN >= 0  )  // No breakdown Diode or Forward biased Zener
+    {
+        *admit   = m_satCur * m_vdCoef*eval;
+        *current = m_satCur * (eval-1);
+    }else{                               // Reverse biased Zener or Diode with breakdown
+        double expCoef = qExp( (-voltPN-m_zOfset)*m_vzCoef );
+        *admit   = m_satCur * ( m_vdCoef*eval + m_vzCoef*expCoef );
+        *current = m_satCur * ( eval-1 - expCoef ) ;
+    }
 }
 
 void eDiode::SetParameters( double sc, double ec, double bv, double sr )
@@ -51,7 +51,7 @@ class eDiode : public eResistor
  static void getModels();
 
     protected:
-        double limitStep( double vnew, double vold, double scale, double vc );
+        inline void evaluate( double voltPN, double* current, double* admit );
         void SetParameters( double sc, double ec, double bv, double sr );
         void updateValues();
 
@@ -78,7 +78,7 @@ void eMosfet::voltChanged()
 
         if( Vds > gateV ) Vds =gateV;
 
-        double DScurrent = (gateV*Vds-qPow(Vds,2)/2)*satK/m_kRDSon;
+        double DScurrent = (gateV*Vds-Vds*Vds/2)*satK/m_kRDSon;
         if( DScurrent > maxCurrDS ) DScurrent = maxCurrDS;
         current = maxCurrDS-DScurrent;
     }
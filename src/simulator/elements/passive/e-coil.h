@@ -18,6 +18,7 @@ class eCoil : public eResistor
 
         virtual void initialize() override;
         virtual void stamp() override;
+        virtual bool saveState( QDataStream& ) override { return false; } // State not supported yet
         void stampCoil();
 
         void addIductor( eCoil* coil, double g ); // An inductor that induces a current in this coil
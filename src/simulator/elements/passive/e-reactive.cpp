@@ -3,6 +3,8 @@
  *                                                                         *
  ***( see copyright.txt file at root folder )*******************************/
 
+#include <QDataStream>
+
 #include "e-reactive.h"
 #include "e-pin.h"
 #include "e-node.h"
@@ -15,6 +17,7 @@ eReactive::eReactive( QString id )
     m_reacStep = 0;
     m_InitCurr = 0;
     m_InitVolt = 0;
+    m_dcOp = false;
 }
 eReactive::~eReactive(){}
 
@@ -40,13 +43,17 @@ void eReactive::stamp()
         }
         m_ePin[0]->changeCallBack( this );
         m_ePin[1]->changeCallBack( this );
+
+        if( m_InitVolt == 0 && m_InitCurr == 0 ) // Initial state from operating point
+            Simulator::self()->addToReactiveList( this );
     }
     m_running = false;
+    m_dcOp = false;
 }
 
 void eReactive::voltChanged()
 {
-    if( m_running ) return;
+    if( m_running || m_dcOp ) return;
     m_running = true;
     Simulator::self()->addEvent( m_timeStep, this );
 }
@@ -67,6 +74,49 @@ void eReactive::runEvent()
     else m_running = false;
 }
 
+bool eReactive::saveState( QDataStream& s )
+{
+    eResistor::saveState( s );
+    s << m_volt << m_curSource << m_running;
+    return true;
+}
+
+bool eReactive::loadState( QDataStream& s, bool check )
+{
+    if( !eResistor::loadState( s, check ) ) return false;
+
+    double volt, curSource;
+    bool running;
+    s >> volt >> curSource >> running;
+    if( check || s.status() != QDataStream::Ok ) return s.status() == QDataStream::Ok;
+
+    m_volt      = volt;
+    m_curSource = curSource;
+    m_running   = running;
+
+    if( !m_ePin[0]->isConnected() || !m_ePin[1]->isConnected() ) return true;
+    m_ePin[0]->stampCurrent( m_curSource );
+    m_ePin[1]->stampCurrent(-m_curSource );
+    return true;
+}
+
+void eReactive::setDcOp( bool dc )
+{
+    if( dc ){
+        m_dcOp = true;
+        eResistor::setAdmit( dcAdmit() );
+        m_curSource = 0;
+    }else{                                      // Start from operating point state:
+        m_dcOp = false;                         // same current with transient admitance
+        double dcAdmit = m_admit;
+        m_volt = m_ePin[0]->getVoltage() - m_ePin[1]->getVoltage();
+        eResistor::setRes( updtRes() );
+        m_curSource = m_volt*( m_admit-dcAdmit );
+    }
+    m_ePin[0]->stampCurrent( m_curSource );
+    m_ePin[1]->stampCurrent(-m_curSource );
+}
+
 void eReactive::updtReactStep()
 {
     if( m_reacStep ) m_timeStep = m_reacStep;
@@ -18,17 +18,23 @@ class eReactive : public eResistor
         virtual void voltChanged() override;
         virtual void runEvent() override;
 
+        virtual bool saveState( QDataStream& s ) override;
+        virtual bool loadState( QDataStream& s, bool check ) override;
+
         double initVolt() { return m_InitVolt; }
         void setInitVolt( double v ) { m_InitVolt = v; }
 
         double initCurr() { return -m_InitCurr; }
         void setInitCurr( double c ) { m_InitCurr = -c; }
 
+        void setDcOp( bool dc );  // Operating point: use DC equivalent
+
     protected:
         void updtReactStep();
 
         virtual double updtRes(){ return 0.0;}
         virtual double updtCurr(){ return 0.0;}
+        virtual double dcAdmit(){ return cero_doub; } // Open by default (Capacitors)
 
         double m_value; // Capacitance or Inductance
 
@@ -44,6 +50,7 @@ class eReactive : public eResistor
         uint64_t m_timeStep;
 
         bool m_running;
+        bool m_dcOp;
 };
 
 #endif
@@ -3,6 +3,8 @@
  *                                                                         *
  ***( see copyright.txt file at root folder )*******************************/
 
+#include <QDataStream>
+
 #include "e-resistor.h"
 #include "simulator.h"
 #include "e-pin.h"
@@ -32,6 +34,22 @@ void eResistor::stampAdmit()
     m_ePin[1]->stampAdmitance( m_admit );
 }
 
+bool eResistor::saveState( QDataStream& s ) // Admitance can be changed by Components at runtime
+{
+    s << m_admit;
+    return true;
+}
+
+bool eResistor::loadState( QDataStream& s, bool check )
+{
+    double admit;
+    s >> admit;
+    if( check || s.status() != QDataStream::Ok ) return s.status() == QDataStream::Ok;
+
+    eResistor::setAdmit( admit );
+    return true;
+}
+
 void eResistor::setRes( double resist )
 {
     if( resist < 1e-12 ) resist = 1e-12;
@@ -16,6 +16,9 @@ class eResistor : public eElement
 
         virtual void stamp() override;
 
+        virtual bool saveState( QDataStream& s ) override;
+        virtual bool loadState( QDataStream& s, bool check ) override;
+
         virtual double res() { return 1/m_admit; }
         virtual void setRes( double resist );
         double getRes() { return 1/m_admit; }
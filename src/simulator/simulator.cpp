@@ -5,7 +5,10 @@
 
 #include <qtconcurrentrun.h>
 #include <QHash>
+#include <QFile>
+#include <QDataStream>
 #include <math.h>
+#include <string.h>
 
 #include "simulator.h"
 #include "editorwindow.h"
@@ -15,12 +18,16 @@
 #include "mainwindow.h"
 #include "infowidget.h"
 #include "circuitwidget.h"
+#include "circuitview.h"
 #include "circmatrix.h"
 #include "e-element.h"
 #include "socket.h"
+#include "e-reactive.h"
 
 Simulator* Simulator::m_pSelf = NULL;
 
+static const char stateMagic[8] = { 'S','I','M','U','S','T','A','1' };
+
 Simulator::Simulator( QObject* parent )
          : QObject( parent )
 {
@@ -61,7 +68,7 @@ Simulator::~Simulator()
 inline void Simulator::solveMatrix()
 {
     while( m_changedNode ){
-        m_changedNode->stampMatrix();
+        m_changedNode->stampMatrix( m_matrix );
         m_changedNode = m_changedNode->nextCH;
     }
     //if( !m_matrix->solveMatrix() ) // m_matrix sets the eNode voltages
@@ -95,15 +102,13 @@ void Simulator::timerEvent( QTimerEvent* e )  //update at m_timerTick_ms rate (5
     else if( m_warning < 0 )
     { if( ++m_warning == 0 ) CircuitWidget::self()->setMsg( " "+tr("Running")+" ", 0 ); }
 
-    if( !m_CircuitFuture.isFinished() ) // Stop remaining parallel thread
-    {
-        simState_t state = m_state;
-        m_state = SIM_WAITING;
-        m_CircuitFuture.waitForFinished();
-        m_state = state;
-    }
+    waitCircuit(); // Stop remaining parallel thread
 
-    for( Updatable* el : m_updateList ) el->updateStep();
+    CircuitView* view = CircuitView::self();
+    QRectF viewRect = view->mapToScene( view->viewport()->rect() ).boundingRect();
+
+    for( Updatable* el : m_updateList ) // Only visible and changed items
+        if( el->needUpdate( viewRect ) ) el->updateStep();
     EditorWindow::self()->outPane()->updateStep(); // OutPanel in Editor can be created before this simulator.
 
     // Calculate Simulation Load
@@ -231,6 +236,7 @@ void Simulator::resetSim()
     m_changedNode = NULL;
     m_voltChanged = NULL;
     m_nonLinear = NULL;
+    m_reactiveList.clear();
 }
 
 void Simulator::createNodes()
@@ -307,6 +313,8 @@ void Simulator::startSim( bool paused )
 
     /// qDebug() << "\nCircuit Matrix looks good";
 
+    solveOperatingPoint();
+
     /*double sps100 = 100*(double)m_psPerSec/1e12; // Speed %
 
     qDebug()  << "\nSpeed:" <<         sps100      << "%"
@@ -333,6 +341,30 @@ void Simulator::startSim( bool paused )
     m_timerId = this->startTimer( m_timerTick_ms, Qt::PreciseTimer ); // Init Timer
 }
 
+void Simulator::solveOperatingPoint() // Initial state: Capacitors open, Inductors shorted
+{
+    if( m_reactiveList.isEmpty() ) return;
+
+    for( eReactive* el : m_reactiveList ) el->setDcOp( true );
+
+    uint32_t maxNlstp = m_maxNlstp;
+    if( !m_maxNlstp || m_maxNlstp > 10000 ) m_maxNlstp = 10000; // Don't hang if not converging
+    m_converged = true;
+    m_state = SIM_RUNNING;
+
+    solveCircuit();
+
+    if( m_warning == 1 ){
+        m_warning = 0;
+        m_NLstep  = 0;
+        qDebug() << "    Operating Point Not Converging";
+    }
+    m_state = SIM_STARTING;
+    m_maxNlstp = maxNlstp;
+
+    for( eReactive* el : m_reactiveList ) el->setDcOp( false );
+}
+
 void Simulator::stopSim()
 {
     if( m_timerId != 0 ){                   // Stop Timer
@@ -389,6 +421,164 @@ void Simulator::resumeSim()
     m_state = SIM_RUNNING;
 }*/
 
+bool Simulator::runTo( uint64_t time )
+{
+    uint64_t psPF = m_psPF;
+    while( m_state == SIM_RUNNING && !m_error && m_circTime < time )
+    {
+        uint64_t left = time-m_circTime;
+        if( m_psPF > left ) m_psPF = left; // Last run ends exactly at time
+        runCircuit();
+    }
+    m_psPF = psPF;
+    return m_state == SIM_RUNNING && !m_error;
+}
+
+void Simulator::waitCircuit()
+{
+    if( m_CircuitFuture.isFinished() ) return;
+    simState_t state = m_state;
+    m_state = SIM_WAITING;
+    m_CircuitFuture.waitForFinished();
+    m_state = state;
+}
+
+bool Simulator::saveState( QString fileName )
+{
+    if( m_state < SIM_PAUSED ) return false;
+    waitCircuit();
+
+    QVector<QByteArray> states; // Get all Element states before writing anything
+    for( eElement* el : m_elementList )
+    {
+        QByteArray data;
+        QDataStream elOut( &data, QIODevice::WriteOnly );
+        if( !el->saveState( elOut ) )
+        {
+            qDebug() << "Simulator::saveState Error: Element state not supported" << el->getId();
+            return false;
+        }
+        states.append( data );
+    }
+    QFile file( fileName );
+    if( !file.open( QIODevice::WriteOnly | QIODevice::Truncate ) )
+    {
+        qDebug() << "Simulator::saveState Error: can't open file" << fileName;
+        return false;
+    }
+    QDataStream out( &file );
+    out.writeRawData( stateMagic, 8 );
+    out << (quint64)m_circTime << (qint32)m_eNodeList.size() << (qint32)m_elementList.size();
+
+    for( eNode* node : m_eNodeList ) out << node->getVolt();
+
+    for( int i=0; i<states.size(); ++i ) // Each Element state in a block: Id + data
+        out << m_elementList.at( i )->getId() << states.at( i );
+    QList<QPair<qint32, quint64>> events; // Element index, time from now
+    for( eElement* ev=m_firstEvent; ev; ev=ev->nextEvent )
+    {
+        int index = m_elementList.indexOf( ev );
+        if( index >= 0 ) events.append( qMakePair( (qint32)index, (quint64)(ev->eventTime-m_circTime) ) );
+    }
+    out << events;
+
+    if( out.status() != QDataStream::Ok )
+    {
+        qDebug() << "Simulator::saveState Error writing file" << fileName;
+        return false;
+    }
+    return true;
+}
+
+bool Simulator::loadState( QString fileName )
+{
+    if( m_state < SIM_PAUSED ) return false;
+    waitCircuit();
+
+    QFile file( fileName );
+    if( !file.open( QIODevice::ReadOnly ) )
+    {
+        qDebug() << "Simulator::loadState Error: can't open file" << fileName;
+        return false;
+    }
+    QDataStream in( &file );
+
+    char magic[8];
+    quint64 circTime;
+    qint32 nodes, elements;
+    if( in.readRawData( magic, 8 ) != 8 || memcmp( magic, stateMagic, 8 ) != 0 )
+    {
+        qDebug() << "Simulator::loadState Error: not a simulation state file" << fileName;
+        return false;
+    }
+    in >> circTime >> nodes >> elements;
+    if( nodes != m_eNodeList.size() || elements != m_elementList.size() )
+    {
+        qDebug() << "Simulator::loadState Error: state doesn't match this Circuit";
+        return false;
+    }
+    // Read and check everything before changing anything
+    QVector<double> volts( nodes );
+    for( int i=0; i<nodes; ++i ) in >> volts[i];
+
+    QVector<QByteArray> states( elements );
+    for( int i=0; i<elements; ++i )
+    {
+        QString id;
+        in >> id >> states[i];
+        if( id != m_elementList.at( i )->getId() )
+        {
+            qDebug() << "Simulator::loadState Error: Element not found" << id;
+            return false;
+    }   }
+    QList<QPair<qint32, quint64>> events;
+    in >> events;
+
+    if( in.status() != QDataStream::Ok )
+    {
+        qDebug() << "Simulator::loadState Error reading file" << fileName;
+        return false;
+    }
+    for( QPair<qint32, quint64> event : events )
+    {
+        if( event.first >= 0 && event.first < elements ) continue;
+        qDebug() << "Simulator::loadState Error: wrong event" << event.first;
+        return false;
+    }
+    for( int i=0; i<elements; ++i ) // Elements validate their data
+    {
+        QDataStream elIn( states.at( i ) );
+        eElement* el = m_elementList.at( i );
+        if( el->loadState( elIn, true ) && elIn.status() == QDataStream::Ok && elIn.atEnd() ) continue;
+        qDebug() << "Simulator::loadState Error: wrong Element state" << el->getId();
+        return false;
+    }
+
+    for( eElement* el : m_elementList ) { el->eventTime = 0; el->nextEvent = NULL; }
+    clearEventList();
+
+    m_circTime = circTime;
+    m_tStep    = circTime;
+    m_lastStep = circTime;
+    m_NLstep   = 0;
+    m_converged = true;
+
+    for( int i=0; i<nodes; ++i ) m_eNodeList.at( i )->setVolt( volts.at( i ), true ); // Non Linear Elements must update at restored Volts
+
+    for( int i=0; i<elements; ++i )
+    {
+        QDataStream elIn( states.at( i ) );
+        m_elementList.at( i )->loadState( elIn, false );
+    }
+    for( int i=events.size()-1; i>=0; --i ) // Reverse order keeps order of events at same time
+    {
+        QPair<qint32, quint64> event = events.at( i );
+        addEvent( event.second, m_elementList.at( event.first ) );
+    }
+    InfoWidget::self()->setCircTime( m_circTime );
+    return true;
+}
+
 void Simulator::setFps( uint64_t fps )
 {
     m_fps = fps;
@@ -28,6 +28,7 @@ class eElement;
 class Socket;
 class eNode;
 class CircMatrix;
+class eReactive;
 
 class Simulator : public QObject
 {
@@ -46,8 +47,14 @@ class Simulator : public QObject
         void startSim( bool paused=false );
         void pauseSim();
         void resumeSim();
+        void waitCircuit(); // Wait until runCircuit thread finishes
         void stopSim();
 
+        bool runTo( uint64_t time ); // Run in calling thread without GUI updates
+
+        bool saveState( QString fileName ); // Simulation checkpoint
+        bool loadState( QString fileName );
+
         void setWarning( int warning ) { m_warning = warning; }
         
         uint64_t fps() { return m_fps; }
@@ -98,6 +105,8 @@ class Simulator : public QObject
         void addToSocketList( Socket* el );
         void remFromSocketList( Socket* el );
 
+        void addToReactiveList( eReactive* el ) { m_reactiveList.append( el ); }
+
     private:
  static Simulator* m_pSelf;
 
@@ -111,6 +120,7 @@ class Simulator : public QObject
         void runCircuit();
         inline void solveCircuit();
         inline void solveMatrix();
+        void solveOperatingPoint();
 
         inline void clearEventList();
 
@@ -135,6 +145,7 @@ class Simulator : public QObject
         QList<eElement*> m_elementList;
         QList<Updatable*> m_updateList;
         QList<Socket*> m_socketList;
+        QList<eReactive*> m_reactiveList;
 
         simState_t m_state;
         simState_t m_oldState;
@@ -8,6 +8,7 @@
 
 #include <QtMath>
 #include <QList>
+#include <QSet>
 
 class QDomDocument;
 class QByteArray;
@@ -96,8 +97,11 @@ QString getStrPointF( QPointF p );
 template <typename T>
 QList<T> substract( QList<T> &l0, QList<T> &l1 ) // returns l0-l1
 {
+    QSet<T> set;
+    for( T el : l1 ) set.insert( el );
+
     QList<T> list;
-    for( T el : l0 ) if( !l1.contains( el ) ) list.append( el );
+    for( T el : l0 ) if( !set.contains( el ) ) list.append( el );
     return list;
 }
 #endif